@@ -1,14 +1,10 @@
 #version 450
 
-// Per-particle attributes (instanced, binding 0)
-layout(location = 0) in vec3 inPosition;      // Particle world position
-layout(location = 1) in float inLifetime;     // Remaining lifetime
-layout(location = 2) in vec3 inVelocity;      // Velocity (unused in vertex shader)
-layout(location = 3) in float inAge;          // Current age
-layout(location = 4) in vec4 inColor;         // Particle color
-layout(location = 5) in vec2 inSize;          // Particle size
-layout(location = 6) in float inRotation;     // Rotation in degrees
-layout(location = 7) in float inRotationSpeed; // Rotation speed (unused)
+// Per-particle attributes (instanced, binding 0) - packed ParticleVertex, 20 bytes
+layout(location = 0) in uvec4 inOffsetEmitter; // xyz: half-float offset bits, w: emitter index
+layout(location = 1) in vec2 inSize;           // Particle size (half floats)
+layout(location = 2) in vec4 inColor;          // Particle color (unorm8)
+layout(location = 3) in vec4 inRotation;       // x: rotation as a fraction of a turn (unorm8)
 
 // Uniform buffer (camera matrices)
 layout(binding = 0) uniform UniformBufferObject {
@@ -17,6 +13,11 @@ layout(binding = 0) uniform UniformBufferObject {
     mat4 proj;
 } ubo;
 
+// Per-emitter world origins; particle positions are stored relative to these
+layout(std430, binding = 1) readonly buffer EmitterOrigins {
+    vec4 origins[];
+} emitters;
+
 // Outputs to fragment shader
 layout(location = 0) out vec4 fragColor;
 layout(location = 1) out vec2 fragTexCoord;
@@ -46,7 +47,7 @@ void main() {
     vec2 quadPos = quadVertices[vertexId];
 
     // Apply rotation
-    float rad = radians(inRotation);
+    float rad = radians(inRotation.x * 360.0);
     float cosR = cos(rad);
     float sinR = sin(rad);
     vec2 rotatedPos = vec2(
@@ -62,7 +63,11 @@ void main() {
     vec3 cameraUp = vec3(ubo.view[0][1], ubo.view[1][1], ubo.view[2][1]);
 
     // Compute world position with billboard offset
-    vec3 worldPos = inPosition +
+    vec3 offset = vec3(unpackHalf2x16(inOffsetEmitter.x).x,
+                       unpackHalf2x16(inOffsetEmitter.y).x,
+                       unpackHalf2x16(inOffsetEmitter.z).x);
+    vec3 position = emitters.origins[inOffsetEmitter.w].xyz + offset;
+    vec3 worldPos = position +
                     cameraRight * rotatedPos.x +
                     cameraUp * rotatedPos.y;
 
@@ -9,16 +9,15 @@ struct UniformBufferObject {
 
 @group(0) @binding(0) var<uniform> ubo: UniformBufferObject;
 
-// Per-particle attributes (instanced)
+// Per-emitter world origins; particle positions are stored relative to these
+@group(0) @binding(1) var<storage, read> emitterOrigins: array<vec4<f32>>;
+
+// Per-particle attributes (instanced) - packed ParticleVertex, 20 bytes
 struct VertexInput {
-    @location(0) position: vec3<f32>,       // Particle world position
-    @location(1) lifetime: f32,             // Remaining lifetime
-    @location(2) velocity: vec3<f32>,       // Velocity (unused in vertex shader)
-    @location(3) age: f32,                  // Current age
-    @location(4) color: vec4<f32>,          // Particle color
-    @location(5) size: vec2<f32>,           // Particle size
-    @location(6) rotation: f32,             // Rotation in degrees
-    @location(7) rotationSpeed: f32,        // Rotation speed (unused)
+    @location(0) offsetEmitter: vec4<u32>,  // xyz: half-float offset bits, w: emitter index
+    @location(1) size: vec2<f32>,           // Particle size (half floats)
+    @location(2) color: vec4<f32>,          // Particle color (unorm8)
+    @location(3) rotation: vec4<f32>,       // x: rotation as a fraction of a turn (unorm8)
     @builtin(vertex_index) vertexIndex: u32,
 }
 
@@ -56,7 +55,7 @@ fn vs_main(input: VertexInput) -> VertexOutput {
     var quadPos = quadVertices[vertexId];
 
     // Apply rotation
-    let rad = radians(input.rotation);
+    let rad = radians(input.rotation.x * 360.0);
     let cosR = cos(rad);
     let sinR = sin(rad);
     var rotatedPos = vec2<f32>(
@@ -72,7 +71,11 @@ fn vs_main(input: VertexInput) -> VertexOutput {
     let cameraUp = vec3<f32>(ubo.view[0][1], ubo.view[1][1], ubo.view[2][1]);
 
     // Compute world position with billboard offset
-    let worldPos = input.position +
+    let offset = vec3<f32>(unpack2x16float(input.offsetEmitter.x).x,
+                           unpack2x16float(input.offsetEmitter.y).x,
+                           unpack2x16float(input.offsetEmitter.z).x);
+    let position = emitterOrigins[input.offsetEmitter.w].xyz + offset;
+    let worldPos = position +
                    cameraRight * rotatedPos.x +
                    cameraUp * rotatedPos.y;
 
@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <functional>
 #include <chrono>
+#include <filesystem>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
@@ -86,19 +87,24 @@ void Application::initGameLogic() {
     auto* rhiDevice = renderer->getRHIDevice();
     auto* rhiQueue = renderer->getGraphicsQueue();
 
-    // Create WorldManager
+    // Create WorldManager; a saved world replaces the default one
     worldManager = std::make_unique<WorldManager>(rhiDevice, rhiQueue);
-    worldManager->initialize();
-
-    // Initialize mock data generator
     mockDataGen = std::make_unique<MockDataGenerator>();
+    bool restored = std::filesystem::exists(WORLD_SNAPSHOT_PATH) && loadWorldSnapshot(WORLD_SNAPSHOT_PATH);
+    if (!restored) {
+        worldManager->initialize();
+    }
+
+    // A slot for every stress-test symbol; tick windows match the finest candles
+    marketDataQueue = std::make_unique<MarketDataQueue>(
+        1u << 17, PriceHistory::bucketWidthMs(HistoryResolution::Second));
 
     // Initialize Particle System
     particleSystem = std::make_unique<effects::ParticleSystem>(rhiDevice, rhiQueue);
 
     // Create sample buildings in a grid pattern
     auto* buildingManager = worldManager->getBuildingManager();
-    if (buildingManager) {
+    if (buildingManager && !restored) {
         int gridSize = 4;
         float spacing = 30.0f;
         float startX = -(gridSize - 1) * spacing / 2.0f;
@@ -131,6 +137,12 @@ void Application::mainLoop() {
         mainLoopFrame();
     }
     renderer->waitIdle();
+
+    if (worldManager) {
+        snapshotSaver.wait();           // An autosave may still be writing the same file
+        worldManager->resumeLive();     // Save the present, not a scrubbed past
+        worldsnapshot::save(*worldManager, WORLD_SNAPSHOT_PATH);
+    }
 }
 
 void Application::mainLoopFrame() {
@@ -147,24 +159,79 @@ void Application::mainLoopFrame() {
     float deltaTime = std::chrono::duration<float>(currentFrameTime - lastFrameTime).count();
     lastFrameTime = currentFrameTime;
 
+    // Present wait (if enabled): stamp the previous frame's display time and
+    // start this frame right after it
+    renderer->waitForPresentedFrame();
+
     glfwPollEvents();
     processInput();
     renderer->updateCamera(camera->getViewMatrix(), camera->getProjectionMatrix(), camera->getPosition());
 
         // NEW: Update Game World
         if (worldManager) {
-            // Update price data periodically
-            priceUpdateTimer += deltaTime;
-            if (priceUpdateTimer >= priceUpdateInterval) {
-                priceUpdateTimer = 0.0f;
-
-                // Generate mock price updates
-                PriceUpdateBatch updates = mockDataGen->generateUpdates();
-                worldManager->updateMarketData(updates);
+            bool feedActive = false;
+#ifndef __EMSCRIPTEN__
+            feedActive = feedIngestor != nullptr;  // The ingestion thread pushes on its own
+#endif
+            uint64_t replayLoops = 0;
+            if (tickReplayer) {
+                // Recorded market data replaces the mock generator
+                replayLoops = tickReplayer->getLoopCount();
+                tickReplayer->advance(deltaTime, *marketDataQueue);
+            } else if (!feedActive) {
+                // Update price data periodically
+                priceUpdateTimer += deltaTime;
+                if (priceUpdateTimer >= priceUpdateInterval) {
+                    priceUpdateTimer = 0.0f;
+
+                    // Generate mock price updates (a feed thread would push the same way)
+                    PriceUpdateBatch updates = mockDataGen->generateUpdates();
+                    uint64_t nowMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count());
+                    for (auto& update : updates) {
+                        update.timestamp = nowMs;
+                    }
+                    if (tickRecorder) {
+                        if (!tickRecorder->append(updates, nowMs)) {
+                            tickRecorder.reset();
+                        }
+                    }
+                    marketDataQueue->pushBatch(updates);
+                }
+            }
+
+            // Apply at most one update per changed symbol
+            marketDataQueue->drain(marketDataBatch, marketDataWindows);
+            if (!marketDataBatch.empty()) {
+                uint64_t simulateTime = latency::now();
+                for (const auto& update : marketDataBatch) {
+                    uint64_t ingestTime = update.ingestTime;
+                    latencyTracer.record(LatencyTracer::Stage::FeedToSimulate,
+                                         simulateTime > ingestTime ? simulateTime - ingestTime : 0);
+                }
+                worldManager->updateMarketData(marketDataBatch, simulateTime, marketDataWindows);
+            }
+
+            // A looping replay wrapped: the ticks drained above were the last
+            // before the jump, the next ones restart recorded time
+            if (tickReplayer && tickReplayer->getLoopCount() != replayLoops) {
+                restartMarketTime();
             }
 
             // Update animations
             worldManager->update(deltaTime);
+
+#ifndef __EMSCRIPTEN__
+            // Periodic snapshot: a crash restarts into the world as of the last save.
+            // Only the copy happens here; the file is written on the saver's thread
+            if (snapshotInterval > 0.0f) {
+                snapshotTimer += deltaTime;
+                if (snapshotTimer >= snapshotInterval && !worldManager->isScrubbing()
+                    && snapshotSaver.request(*worldManager, WORLD_SNAPSHOT_PATH)) {
+                    snapshotTimer = 0.0f;
+                }
+            }
+#endif
             
             // DEBUG: Force dramatic height change on CENTER building to test shadow updates
             static float debugTime = 0.0f;
@@ -172,16 +239,16 @@ void Application::mainLoopFrame() {
             auto* buildingManager = worldManager->getBuildingManager();
             if (buildingManager) {
                 // Use center building (grid position 1,1 or 2,2)
-                auto* centerBuilding = buildingManager->getBuildingByTicker("BUILDING_1_1");
-                if (!centerBuilding) {
-                    centerBuilding = buildingManager->getBuildingByTicker("BUILDING_2_2");
+                static const SymbolId centerSymbol = SymbolTable::global().intern("BUILDING_1_1");
+                static const SymbolId fallbackSymbol = SymbolTable::global().intern("BUILDING_2_2");
+                uint64_t centerBuilding = buildingManager->getEntityId(centerSymbol);
+                if (centerBuilding == 0) {
+                    centerBuilding = buildingManager->getEntityId(fallbackSymbol);
                 }
-                if (centerBuilding) {
+                if (centerBuilding != 0) {
                     // Oscillate between 20 and 150 height
                     float newHeight = 85.0f + 65.0f * std::sin(debugTime * 1.5f);
-                    centerBuilding->currentHeight = newHeight;
-                    centerBuilding->targetHeight = newHeight;
-                    buildingManager->markObjectBufferDirty();
+                    buildingManager->setBuildingHeight(centerBuilding, newHeight);
                 }
             }
         }
@@ -190,6 +257,9 @@ void Application::mainLoopFrame() {
         if (worldManager) {
             auto* buildingManager = worldManager->getBuildingManager();
             if (buildingManager) {
+                // Distant sectors switch to impostors (marks the buffer dirty on change)
+                buildingManager->updateLod(camera->getPosition());
+
                 // Always update instance buffer if dirty (even with 0 buildings, we have ground)
                 if (buildingManager->isObjectBufferDirty()) {
                     buildingManager->updateObjectBuffer();
@@ -199,8 +269,9 @@ void Application::mainLoopFrame() {
                 rendering::InstancedRenderData renderData;
                 renderData.mesh = buildingManager->getBuildingMesh();
                 renderData.objectBuffer = buildingManager->getObjectBuffer();
-                // Instance count = buildings + ground plane (1)
-                renderData.instanceCount = static_cast<uint32_t>(buildingManager->getBuildingCount() + 1);
+                // Instance count = ground plane (1) + near buildings + impostor cells
+                renderData.instanceCount = buildingManager->getObjectCount();
+                renderData.sectors = buildingManager->getSectorRenderData();
 
                 // Submit to renderer (clean interface)
                 renderer->submitInstancedRenderData(renderData);
@@ -209,6 +280,7 @@ void Application::mainLoopFrame() {
 
         // Update Particle System
         if (particleSystem) {
+            particleSystem->setCamera(camera->getViewMatrix(), camera->getProjectionMatrix(), camera->getPosition());
             particleSystem->update(deltaTime);
             // Submit particle system to renderer
             renderer->submitParticleSystem(particleSystem.get());
@@ -254,6 +326,108 @@ void Application::mainLoopFrame() {
                 imgui->setGpuTimingData(gpuTiming);
             }
 
+            // Market data ingestion counters
+            if (marketDataQueue) {
+                auto queueStats = marketDataQueue->getStats();
+                ImGuiManager::MarketDataStats marketStats;
+                marketStats.queueDepth = queueStats.depth;
+                marketStats.lastDrainSymbols = queueStats.lastDrainSymbols;
+                marketStats.pushed = queueStats.pushed;
+                marketStats.dropped = queueStats.dropped;
+                marketStats.coalesced = queueStats.coalesced;
+                imgui->setMarketDataStats(marketStats);
+            }
+
+            // Sector aggregates: rows are rebuilt only when a price, spawn or delisting changed them
+            if (worldManager && worldManager->getBuildingManager()) {
+                const auto* buildingManager = worldManager->getBuildingManager();
+                const SectorAggregates& aggregates = buildingManager->getSectorAggregates();
+                if (aggregates.getVersion() != sectorStatsVersion) {
+                    const BuildingStore& store = buildingManager->getStore();
+                    ImGuiManager::SectorStats sectorStats;
+                    sectorStats.rows.reserve(aggregates.getSectorCount());
+                    for (uint32_t sector = 0; sector < aggregates.getSectorCount(); ++sector) {
+                        SectorSummary summary = aggregates.getSummary(sector);
+                        if (summary.buildingCount == 0) {
+                            continue;
+                        }
+                        auto& row = sectorStats.rows.emplace_back();
+                        row.name = aggregates.getSectorId(sector);
+                        row.buildingCount = summary.buildingCount;
+                        row.averagePrice = summary.averagePrice;
+                        row.averageChangePercent = summary.averageChangePercent;
+                        row.volumeWeightedChangePercent = summary.volumeWeightedChangePercent;
+                        row.advancers = summary.advancers;
+                        row.decliners = summary.decliners;
+                        row.topGainer = store.record(summary.topGainer).ticker;
+                        row.topGainerChangePercent = summary.topGainerChangePercent;
+                        row.topLoser = store.record(summary.topLoser).ticker;
+                        row.topLoserChangePercent = summary.topLoserChangePercent;
+                    }
+                    imgui->setSectorStats(std::move(sectorStats));
+                    sectorStatsVersion = aggregates.getVersion();
+                }
+            }
+
+            // Tick recording/replay
+            handleReplayRequest(imgui->getAndClearReplayRequest());
+            ImGuiManager::ReplayStatus replayStatus;
+            replayStatus.recording = tickRecorder != nullptr;
+            replayStatus.recordedTicks = tickRecorder ? tickRecorder->getTickCount() : 0;
+            replayStatus.replaying = tickReplayer != nullptr;
+            replayStatus.progress = tickReplayer ? tickReplayer->getProgress() : 0.0f;
+            replayStatus.replayedTicks = tickReplayer ? tickReplayer->getTicksReplayed() : 0;
+            imgui->setReplayStatus(replayStatus);
+
+            // Network feed
+            handleFeedRequest(imgui->getAndClearFeedRequest());
+            ImGuiManager::FeedStatus feedStatus;
+            if (feedIngestor) {
+                auto ingestStats = feedIngestor->getStats();
+                feedStatus.running = true;
+                feedStatus.connected = ingestStats.connected;
+                feedStatus.throttled = ingestStats.throttled;
+                feedStatus.bytesReceived = ingestStats.bytesReceived;
+                feedStatus.ticks = ingestStats.ticks;
+                feedStatus.rejected = ingestStats.rejected;
+                feedStatus.throttleEvents = ingestStats.throttleEvents;
+            }
+            imgui->setFeedStatus(feedStatus);
+
+            // Price-to-photon latency
+            handleLatencyRequest(imgui->getAndClearLatencyRequest());
+            ImGuiManager::LatencyStats latencyStats;
+            for (uint32_t stageIndex = 0; stageIndex < latencyStats.stages.size(); ++stageIndex) {
+                auto stage = static_cast<LatencyTracer::Stage>(stageIndex);
+                auto summary = latencyTracer.getSummary(stage);
+                latencyStats.stages[stageIndex] = {LatencyTracer::stageName(stage), summary.count,
+                                          summary.p50Ms, summary.p99Ms, summary.maxMs};
+            }
+            latencyStats.presentWaitSupported = renderer->isPresentWaitSupported();
+            latencyStats.presentWaitEnabled = renderer->isPresentWaitEnabled();
+            imgui->setLatencyStats(latencyStats);
+
+            // World timeline
+            handleTimelineRequest(imgui->getAndClearTimelineRequest());
+            const WorldHistory& worldHistory = worldManager->getWorldHistory();
+            auto historyStats = worldHistory.getStats();
+            ImGuiManager::TimelineStatus timelineStatus;
+            timelineStatus.oldestTime = worldHistory.getOldestTime();
+            timelineStatus.newestTime = worldHistory.getNewestTime();
+            timelineStatus.scrubbing = worldManager->isScrubbing();
+            timelineStatus.shownTime = worldManager->getScrubTime();
+            timelineStatus.keyframes = historyStats.keyframes;
+            timelineStatus.frames = historyStats.frames;
+            timelineStatus.deltas = historyStats.deltas;
+            timelineStatus.memoryBytes = historyStats.memoryBytes;
+            timelineStatus.memoryBudget = historyStats.memoryBudget;
+            timelineStatus.reconstructMs = historyStats.lastReconstructMs;
+            timelineStatus.reconstructDeltas = historyStats.lastReconstructDeltas;
+            imgui->setTimelineStatus(timelineStatus);
+
+            // World snapshot
+            handleSnapshotRequest(imgui->getAndClearSnapshotRequest());
+
             // Phase 4.1: Handle stress test building count change
             auto scaleReq = imgui->getAndClearScaleRequest();
             if (scaleReq.requested) {
@@ -264,6 +438,24 @@ void Application::mainLoopFrame() {
 
     // Renderer handles both scene and ImGui rendering
     renderer->drawFrame();
+    recordFrameLatency();
+}
+
+void Application::recordFrameLatency() {
+    // Ticks uploaded this frame became visible with this submit; a skipped
+    // frame leaves them pending for the next one that is submitted
+    uint64_t submitTime = renderer->getLastSubmitTime();
+    auto* buildingManager = worldManager ? worldManager->getBuildingManager() : nullptr;
+    if (submitTime != 0 && buildingManager) {
+        buildingManager->takeUploadedTickTimes(uploadedTickTimes);
+        latencyTracer.recordSince(LatencyTracer::Stage::SimulateToSubmit, submitTime, uploadedTickTimes);
+    }
+
+    Renderer::PresentTiming present;
+    if (renderer->takePresentTiming(present)) {
+        latencyTracer.record(LatencyTracer::Stage::SubmitToPresent,
+                             present.presentTime > present.submitTime ? present.presentTime - present.submitTime : 0);
+    }
 }
 
 void Application::processInput() {
@@ -350,8 +542,9 @@ void Application::regenerateBuildings(int targetCount) {
     // Wait for GPU to finish using current buffers
     renderer->waitIdle();
 
-    // Destroy existing buildings
+    // Destroy existing buildings (and the timeline of their prices)
     buildingManager->destroyAllBuildings();
+    worldManager->clearTimeline();
     mockDataGen = std::make_unique<MockDataGenerator>();
 
     // Calculate grid dimensions
@@ -361,21 +554,27 @@ void Application::regenerateBuildings(int targetCount) {
     float startX = -(gridSize - 1) * spacing / 2.0f;
     float startZ = -(gridSize - 1) * spacing / 2.0f;
 
-    int created = 0;
-    for (int x = 0; x < gridSize && created < targetCount; x++) {
-        for (int z = 0; z < gridSize && created < targetCount; z++) {
-            float posX = startX + x * spacing;
-            float posZ = startZ + z * spacing;
-            float height = 10.0f + static_cast<float>(rand() % 50);
-
-            std::string ticker = "B_" + std::to_string(created);
-            buildingManager->createBuilding(ticker, "STRESS", glm::vec3(posX, 0.0f, posZ), height);
-            mockDataGen->registerTicker(ticker, 100.0f + static_cast<float>(rand() % 200));
-            created++;
+    // Bands of grid columns form sectors, so correlated sector moves show up as stripes
+    constexpr int STRESS_SECTORS = 8;
+
+    std::vector<BuildingSpawnDesc> descs;
+    descs.reserve(static_cast<size_t>(std::max(targetCount, 0)));
+    for (int x = 0; x < gridSize && static_cast<int>(descs.size()) < targetCount; x++) {
+        int sector = x * STRESS_SECTORS / gridSize;
+        for (int z = 0; z < gridSize && static_cast<int>(descs.size()) < targetCount; z++) {
+            BuildingSpawnDesc& desc = descs.emplace_back();
+            desc.ticker = "B_" + std::to_string(descs.size() - 1);
+            desc.sectorId = "STRESS_" + std::to_string(sector);
+            desc.position = glm::vec3(startX + x * spacing, 0.0f, startZ + z * spacing);
+            desc.initialPrice = 10.0f + static_cast<float>(rand() % 50);
+            desc.symbol = SymbolTable::global().intern(desc.ticker);
+            mockDataGen->registerSymbol(desc.symbol, 100.0f + static_cast<float>(rand() % 200),
+                                        static_cast<uint32_t>(sector));
         }
     }
 
-    buildingManager->markObjectBufferDirty();
+    // One bulk spawn: parallel init and a single object buffer upload
+    size_t created = buildingManager->createBuildings(descs);
 
     // Auto-adjust camera to fit the new grid
     float gridExtent = gridSize * spacing;
@@ -390,6 +589,175 @@ void Application::regenerateBuildings(int targetCount) {
                            << ", spacing " << spacing << "m, camera dist " << cameraDistance << "m)";
 }
 
+bool Application::loadWorldSnapshot(const std::string& path) {
+    // Restoring replaces the buildings the GPU may still be drawing
+    renderer->waitIdle();
+    if (!worldManager->initializeFromSnapshot(path)) {
+        return false;
+    }
+
+    // Mock prices continue from the restored ones, moving with their sectors
+    mockDataGen = std::make_unique<MockDataGenerator>();
+    const BuildingManager* buildingManager = worldManager->getBuildingManager();
+    const BuildingColumns& columns = buildingManager->getStore().columns();
+    const SectorAggregates& aggregates = buildingManager->getSectorAggregates();
+    for (size_t i = 0; i < columns.symbol.size(); ++i) {
+        uint32_t sector = aggregates.getOwnerSector(static_cast<uint32_t>(i));
+        mockDataGen->registerSymbol(columns.symbol[i], columns.currentPrice[i],
+                                    sector != SectorAggregates::INVALID_SECTOR ? sector : 0);
+    }
+    return true;
+}
+
+void Application::restartMarketTime() {
+    if (worldManager) {
+        // Recorded time restarts the candles and the timeline
+        worldManager->getPriceHistory().clear();
+        worldManager->resumeLive();
+        worldManager->clearTimeline();
+    }
+}
+
+#ifndef __EMSCRIPTEN__
+void Application::handleReplayRequest(const ImGuiManager::ReplayRequest& request) {
+    using Action = ImGuiManager::ReplayRequest::Action;
+
+    switch (request.action) {
+        case Action::StartRecording:
+            tickRecorder = std::make_unique<TickFileWriter>();
+            if (!tickRecorder->open(request.path)) {
+                tickRecorder.reset();
+            }
+            break;
+
+        case Action::StopRecording:
+            tickRecorder.reset();  // Closing writes the index
+            break;
+
+        case Action::StartReplay:
+            tickReplayer.reset();
+            tickFile = std::make_unique<TickFileReader>();
+            if (!tickFile->open(request.path)) {
+                tickFile.reset();
+                break;
+            }
+            tickReplayer = std::make_unique<TickReplayer>(*tickFile);
+            tickReplayer->setSpeed(request.speed);
+            restartMarketTime();
+            LOG_INFO("Replay") << "Replaying " << request.path << " (speed "
+                               << request.speed << "x, 0 = max)";
+            break;
+
+        case Action::StopReplay:
+            tickReplayer.reset();
+            tickFile.reset();
+            break;
+
+        case Action::SetSpeed:
+            if (tickReplayer) {
+                tickReplayer->setSpeed(request.speed);
+            }
+            break;
+
+        case Action::Seek:
+            if (tickReplayer) {
+                tickReplayer->seekFraction(request.seekFraction);
+                restartMarketTime();
+            }
+            break;
+
+        case Action::None:
+            break;
+    }
+}
+
+void Application::handleLatencyRequest(const ImGuiManager::LatencyRequest& request) {
+    using Action = ImGuiManager::LatencyRequest::Action;
+
+    switch (request.action) {
+        case Action::Reset:
+            latencyTracer.reset();
+            break;
+
+        case Action::Export:
+            latencyTracer.writeReport(request.path);
+            break;
+
+        case Action::SetPresentWait:
+            renderer->setPresentWait(request.presentWait);
+            latencyTracer.reset();  // Present samples from the two modes are not comparable
+            break;
+
+        case Action::None:
+            break;
+    }
+}
+
+void Application::handleTimelineRequest(const ImGuiManager::TimelineRequest& request) {
+    using Action = ImGuiManager::TimelineRequest::Action;
+
+    switch (request.action) {
+        case Action::Scrub:
+            if (!worldManager->scrubTo(request.timestamp)) {
+                LOG_WARN("Timeline") << "Time " << request.timestamp << " is no longer in the history";
+            }
+            break;
+
+        case Action::Live:
+            worldManager->resumeLive();
+            break;
+
+        case Action::None:
+            break;
+    }
+}
+
+void Application::handleSnapshotRequest(const ImGuiManager::SnapshotRequest& request) {
+    using Action = ImGuiManager::SnapshotRequest::Action;
+
+    switch (request.action) {
+        case Action::Save:
+            snapshotSaver.wait();           // Never two writers on one "<path>.tmp"
+            worldManager->resumeLive();     // Save the present, not a scrubbed past
+            worldsnapshot::save(*worldManager, request.path);
+            break;
+
+        case Action::Load:
+            loadWorldSnapshot(request.path);
+            break;
+
+        case Action::None:
+            break;
+    }
+}
+
+void Application::handleFeedRequest(const ImGuiManager::FeedRequest& request) {
+    using Action = ImGuiManager::FeedRequest::Action;
+
+    switch (request.action) {
+        case Action::Connect: {
+            FeedEndpoint endpoint;
+            if (!FeedEndpoint::parse(request.endpoint, endpoint)) {
+                LOG_ERROR("Feed") << "Invalid feed endpoint: " << request.endpoint;
+                break;
+            }
+            feedIngestor = std::make_unique<FeedIngestor>(*marketDataQueue);
+            if (!feedIngestor->start(endpoint)) {
+                feedIngestor.reset();
+            }
+            break;
+        }
+
+        case Action::Disconnect:
+            feedIngestor.reset();  // Joins the ingestion thread
+            break;
+
+        case Action::None:
+            break;
+    }
+}
+#endif
+
 void Application::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
     auto app = reinterpret_cast<Application*>(glfwGetWindowUserPointer(window));
 
@@ -4,7 +4,16 @@
 #include "src/scene/Camera.hpp"
 #include "src/game/managers/WorldManager.hpp"
 #include "src/game/sync/MockDataGenerator.hpp"
+#include "src/game/sync/MarketDataQueue.hpp"
+#include "src/game/sync/TickReplayer.hpp"
+#include "src/game/world/WorldSnapshot.hpp"
 #include "src/effects/ParticleSystem.hpp"
+#include "src/utils/LatencyTracer.hpp"
+
+#ifndef __EMSCRIPTEN__
+#include "src/game/sync/FeedIngestor.hpp"
+#include "src/ui/ImGuiManager.hpp"
+#endif
 
 #include <GLFW/glfw3.h>
 #include <memory>
@@ -50,6 +59,7 @@ private:
     static constexpr uint32_t WINDOW_WIDTH = 800;
     static constexpr uint32_t WINDOW_HEIGHT = 600;
     static constexpr const char* WINDOW_TITLE = "Mini-Engine";
+    static constexpr const char* WORLD_SNAPSHOT_PATH = "world.snapshot";  // Loaded at startup, autosaved
 
     // Validation layers
     const std::vector<const char*> validationLayers = {
@@ -72,6 +82,21 @@ private:
     std::unique_ptr<MockDataGenerator> mockDataGen;
     float priceUpdateTimer = 0.0f;
     float priceUpdateInterval = 1.0f;            // Update prices every N seconds
+    std::unique_ptr<MarketDataQueue> marketDataQueue;  // Feed threads -> frame loop
+    PriceUpdateBatch marketDataBatch;            // Drained updates, reused every frame
+    std::vector<TickWindow> marketDataWindows;   // OHLC of every drained tick, for candles
+    std::unique_ptr<TickFileWriter> tickRecorder;      // Records generated updates while set
+    std::unique_ptr<TickFileReader> tickFile;          // Recording being replayed
+    std::unique_ptr<TickReplayer> tickReplayer;        // Replaces the mock generator while set
+    LatencyTracer latencyTracer;                       // Price-to-photon latency histograms
+    std::vector<uint64_t> uploadedTickTimes;           // Reused by recordFrameLatency()
+    uint64_t sectorStatsVersion = ~0ull;               // Sector aggregates version last shown in the UI
+    float snapshotTimer = 0.0f;
+    float snapshotInterval = 60.0f;                    // Autosave the world every N seconds (0 = off)
+    worldsnapshot::AsyncSaver snapshotSaver;           // Autosaves write off the frame thread
+#ifndef __EMSCRIPTEN__
+    std::unique_ptr<FeedIngestor> feedIngestor;        // Network feed thread; replaces the mock generator while set
+#endif
 
     // Particle System
     std::unique_ptr<effects::ParticleSystem> particleSystem;
@@ -97,9 +122,35 @@ private:
     // Input handling
     void processInput();
 
+    // Latency tracing: submit/present stages of the frame just drawn
+    void recordFrameLatency();
+
     // Phase 4.1: Stress test
     void regenerateBuildings(int targetCount);
 
+    // Replace the world with a snapshot and re-register its symbols with the mock generator
+    bool loadWorldSnapshot(const std::string& path);
+
+    // Replay time jumped (start, seek, loop): clear the candles and the world timeline
+    void restartMarketTime();
+
+#ifndef __EMSCRIPTEN__
+    // Tick recording/replay (requests come from the ImGui "Market Replay" panel)
+    void handleReplayRequest(const ImGuiManager::ReplayRequest& request);
+
+    // Network feed ingestion (requests come from the ImGui "Market Feed" panel)
+    void handleFeedRequest(const ImGuiManager::FeedRequest& request);
+
+    // Latency panel actions (reset, export, present wait)
+    void handleLatencyRequest(const ImGuiManager::LatencyRequest& request);
+
+    // Timeline scrubbing (requests come from the ImGui "Timeline" panel)
+    void handleTimelineRequest(const ImGuiManager::TimelineRequest& request);
+
+    // World snapshot save/load (requests come from the ImGui "World Snapshot" panel)
+    void handleSnapshotRequest(const ImGuiManager::SnapshotRequest& request);
+#endif
+
     // Callbacks
     static void framebufferResizeCallback(GLFWwindow* window, int width, int height);
     static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
@@ -6,10 +6,10 @@
 namespace effects {
 
 /**
- * @brief GPU-compatible particle data structure
+ * @brief Full simulation state of one particle
  *
- * Aligned to 16 bytes for efficient GPU access.
- * Total size: 64 bytes per particle.
+ * Gathered from an emitter's SoA streams (ParticleEmitter::getParticle).
+ * Not uploaded; the GPU draws ParticleVertex.
  */
 struct Particle {
     // Position and lifetime (16 bytes)
@@ -33,6 +33,34 @@ struct Particle {
     float normalizedAge() const { return lifetime > 0.0f ? age / (age + lifetime) : 1.0f; }
 };
 
+/**
+ * @brief How an emitter's particles are composited
+ *
+ * Additive particles are order-independent. Alpha-blended particles are
+ * depth-sorted back-to-front before upload.
+ */
+enum class ParticleBlendMode {
+    Additive,       // src * srcAlpha + dst (fire, glow, sparks)
+    AlphaBlend      // src * srcAlpha + dst * (1 - srcAlpha) (smoke)
+};
+
+/**
+ * @brief Packed per-instance data drawn by ParticleRenderer (20 bytes)
+ *
+ * Holds only what a billboard needs. Position is a half-float offset from the
+ * emitter origin; the shader adds origins[emitterIndex] from the per-frame
+ * emitter origin buffer, which keeps half precision local to each effect.
+ */
+struct ParticleVertex {
+    uint16_t offset[3];     // Half-float xyz offset from the emitter origin
+    uint16_t emitterIndex;  // Index into the emitter origin buffer
+    uint16_t size[2];       // Half-float billboard size
+    uint8_t color[4];       // RGBA8 unorm
+    uint8_t rotation;       // Unorm8 fraction of a full turn
+    uint8_t padding[3];
+};
+static_assert(sizeof(ParticleVertex) == 20, "ParticleVertex must match the particle vertex layout");
+
 /**
  * @brief Emitter configuration for spawning particles
  */
@@ -89,6 +117,9 @@ struct EmitterConfig {
     // Rotation
     float minRotationSpeed = 0.0f;
     float maxRotationSpeed = 0.0f;
+
+    // Compositing
+    ParticleBlendMode blendMode = ParticleBlendMode::Additive;
 };
 
 /**
@@ -162,6 +193,7 @@ inline EmitterConfig createEffectConfig(ParticleEffectType type) {
             config.boxExtents = glm::vec3(0.3f, 0.1f, 0.3f);
             config.gravity = glm::vec3(0.0f, -1.0f, 0.0f);
             config.drag = 0.3f;
+            config.blendMode = ParticleBlendMode::AlphaBlend;  // Gray smoke must occlude, not brighten
             break;
 
         case ParticleEffectType::Sparks:
@@ -25,12 +25,18 @@ bool ParticleRenderer::initialize(rhi::TextureFormat colorFormat, rhi::TextureFo
         return false;
     }
 
-    if (!createBindGroups()) {
-        std::cerr << "[ParticleRenderer] Failed to create bind groups\n";
+    if (!createBindGroupLayout()) {
+        std::cerr << "[ParticleRenderer] Failed to create bind group layout\n";
         return false;
     }
 
-    if (!createPipeline(colorFormat, depthFormat, nativeRenderPass)) {
+    if (!createPipelineLayout()) {
+        std::cerr << "[ParticleRenderer] Failed to create pipeline layout\n";
+        return false;
+    }
+
+    if (!createPipeline(colorFormat, depthFormat, nativeRenderPass, BlendMode::Additive) ||
+        !createPipeline(colorFormat, depthFormat, nativeRenderPass, BlendMode::AlphaBlend)) {
         std::cerr << "[ParticleRenderer] Failed to create pipeline\n";
         return false;
     }
@@ -101,62 +107,64 @@ bool ParticleRenderer::createUniformBuffers() {
     return true;
 }
 
-bool ParticleRenderer::createBindGroups() {
-    // Create bind group layout
+bool ParticleRenderer::createBindGroupLayout() {
     rhi::BindGroupLayoutDesc layoutDesc;
     layoutDesc.entries.push_back(rhi::BindGroupLayoutEntry(0, rhi::ShaderStage::Vertex, rhi::BindingType::UniformBuffer));
+    layoutDesc.entries.push_back(rhi::BindGroupLayoutEntry(1, rhi::ShaderStage::Vertex, rhi::BindingType::StorageBuffer));
     layoutDesc.label = "ParticleBindGroupLayout";
 
     m_bindGroupLayout = m_device->createBindGroupLayout(layoutDesc);
-    if (!m_bindGroupLayout) return false;
-
-    // Create bind groups for each frame
-    for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
-        rhi::BindGroupDesc groupDesc;
-        groupDesc.layout = m_bindGroupLayout.get();
-        groupDesc.entries.push_back(rhi::BindGroupEntry::Buffer(0, m_uniformBuffers[i].get(), 0, sizeof(UniformData)));
-        groupDesc.label = "ParticleBindGroup";
+    return m_bindGroupLayout != nullptr;
+}
 
-        m_bindGroups[i] = m_device->createBindGroup(groupDesc);
-        if (!m_bindGroups[i]) return false;
+bool ParticleRenderer::updateBindGroup(uint32_t frameIndex, rhi::RHIBuffer* originBuffer) {
+    // The emitter origin buffer is reallocated on growth; this slot's previous
+    // submission has completed, so its old bind group can be replaced here.
+    if (m_bindGroups[frameIndex] && m_boundOriginBuffers[frameIndex] == originBuffer) {
+        return true;
     }
 
-    return true;
+    rhi::BindGroupDesc groupDesc;
+    groupDesc.layout = m_bindGroupLayout.get();
+    groupDesc.entries.push_back(rhi::BindGroupEntry::Buffer(0, m_uniformBuffers[frameIndex].get(), 0, sizeof(UniformData)));
+    groupDesc.entries.push_back(rhi::BindGroupEntry::Buffer(1, originBuffer, 0, originBuffer->getSize()));
+    groupDesc.label = "ParticleBindGroup";
+
+    m_bindGroups[frameIndex] = m_device->createBindGroup(groupDesc);
+    m_boundOriginBuffers[frameIndex] = m_bindGroups[frameIndex] ? originBuffer : nullptr;
+    return m_bindGroups[frameIndex] != nullptr;
 }
 
-bool ParticleRenderer::createPipeline(rhi::TextureFormat colorFormat, rhi::TextureFormat depthFormat,
-                                       void* nativeRenderPass) {
-    // Create pipeline layout
+bool ParticleRenderer::createPipelineLayout() {
     rhi::PipelineLayoutDesc layoutDesc;
     layoutDesc.bindGroupLayouts.push_back(m_bindGroupLayout.get());
     layoutDesc.label = "ParticlePipelineLayout";
 
     m_pipelineLayout = m_device->createPipelineLayout(layoutDesc);
-    if (!m_pipelineLayout) return false;
+    return m_pipelineLayout != nullptr;
+}
 
+bool ParticleRenderer::createPipeline(rhi::TextureFormat colorFormat, rhi::TextureFormat depthFormat,
+                                       void* nativeRenderPass, BlendMode blendMode) {
     // Create render pipeline
     rhi::RenderPipelineDesc pipelineDesc;
-    pipelineDesc.label = "ParticlePipeline";
+    pipelineDesc.label = blendMode == BlendMode::Additive ? "ParticlePipelineAdditive" : "ParticlePipelineAlpha";
     pipelineDesc.layout = m_pipelineLayout.get();
 
     // Shaders
     pipelineDesc.vertexShader = m_vertexShader.get();
     pipelineDesc.fragmentShader = m_fragmentShader.get();
 
-    // Vertex attributes for particle data (instanced)
-    // Particle struct: 64 bytes total
+    // Vertex attributes for packed particle data (instanced)
+    // ParticleVertex struct: 20 bytes total
     rhi::VertexBufferLayout vertexLayout;
-    vertexLayout.stride = 64;  // sizeof(Particle)
+    vertexLayout.stride = sizeof(ParticleVertex);
     vertexLayout.inputRate = rhi::VertexInputRate::Instance;  // Instanced
     vertexLayout.attributes = {
-        rhi::VertexAttribute(0, 0, rhi::TextureFormat::RGB32Float, 0),    // position (offset 0)
-        rhi::VertexAttribute(1, 0, rhi::TextureFormat::R32Float,   12),   // lifetime (offset 12)
-        rhi::VertexAttribute(2, 0, rhi::TextureFormat::RGB32Float, 16),   // velocity (offset 16)
-        rhi::VertexAttribute(3, 0, rhi::TextureFormat::R32Float,   28),   // age (offset 28)
-        rhi::VertexAttribute(4, 0, rhi::TextureFormat::RGBA32Float, 32),  // color (offset 32)
-        rhi::VertexAttribute(5, 0, rhi::TextureFormat::RG32Float,  48),   // size (offset 48)
-        rhi::VertexAttribute(6, 0, rhi::TextureFormat::R32Float,   56),   // rotation (offset 56)
-        rhi::VertexAttribute(7, 0, rhi::TextureFormat::R32Float,   60),   // rotationSpeed (offset 60)
+        rhi::VertexAttribute(0, 0, rhi::TextureFormat::RGBA16Uint, 0),    // half offset xyz + emitter index (offset 0)
+        rhi::VertexAttribute(1, 0, rhi::TextureFormat::RG16Float,  8),    // size (offset 8)
+        rhi::VertexAttribute(2, 0, rhi::TextureFormat::RGBA8Unorm, 12),   // color (offset 12)
+        rhi::VertexAttribute(3, 0, rhi::TextureFormat::RGBA8Unorm, 16),   // rotation in x (offset 16)
     };
     pipelineDesc.vertex.buffers.push_back(vertexLayout);
 
@@ -178,7 +186,7 @@ bool ParticleRenderer::createPipeline(rhi::TextureFormat colorFormat, rhi::Textu
     colorTarget.format = colorFormat;
     colorTarget.blend.blendEnabled = true;
 
-    if (m_blendMode == BlendMode::Additive) {
+    if (blendMode == BlendMode::Additive) {
         // Additive blending: src + dst
         colorTarget.blend.srcColorFactor = rhi::BlendFactor::SrcAlpha;
         colorTarget.blend.dstColorFactor = rhi::BlendFactor::One;
@@ -203,8 +211,9 @@ bool ParticleRenderer::createPipeline(rhi::TextureFormat colorFormat, rhi::Textu
         pipelineDesc.nativeRenderPass = nativeRenderPass;
     }
 
-    m_pipeline = m_device->createRenderPipeline(pipelineDesc);
-    return m_pipeline != nullptr;
+    auto& pipeline = m_pipelines[static_cast<size_t>(blendMode)];
+    pipeline = m_device->createRenderPipeline(pipelineDesc);
+    return pipeline != nullptr;
 }
 
 void ParticleRenderer::updateCamera(const glm::mat4& view, const glm::mat4& projection) {
@@ -215,15 +224,18 @@ void ParticleRenderer::updateCamera(const glm::mat4& view, const glm::mat4& proj
 void ParticleRenderer::render(rhi::RHIRenderPassEncoder* encoder,
                               ParticleSystem& particleSystem,
                               uint32_t frameIndex) {
-    if (!encoder || !m_pipeline) return;
+    if (!encoder || !m_pipelines[0] || !m_pipelines[1]) return;
 
-    // Upload particles to GPU
-    particleSystem.uploadToGPU();
+    // Upload particles into this frame's buffer (fence for frameIndex already waited)
+    particleSystem.uploadToGPU(frameIndex, m_viewMatrix);
 
-    rhi::RHIBuffer* particleBuffer = particleSystem.getParticleBuffer();
-    uint32_t particleCount = particleSystem.getTotalActiveParticles();
+    rhi::RHIBuffer* particleBuffer = particleSystem.getParticleBuffer(frameIndex);
+    rhi::RHIBuffer* originBuffer = particleSystem.getEmitterOriginBuffer(frameIndex);
+    uint32_t particleCount = particleSystem.getUploadedCount(frameIndex);
+    uint32_t alphaCount = particleSystem.getAlphaCount(frameIndex);
 
-    if (!particleBuffer || particleCount == 0) return;
+    if (!particleBuffer || !originBuffer || particleCount == 0) return;
+    if (!updateBindGroup(frameIndex, originBuffer)) return;
 
     // Update uniform buffer
     UniformData ubo;
@@ -237,20 +249,18 @@ void ParticleRenderer::render(rhi::RHIRenderPassEncoder* encoder,
         m_uniformBuffers[frameIndex]->unmap();
     }
 
-    // Set pipeline and bind group
-    encoder->setPipeline(m_pipeline.get());
-    encoder->setBindGroup(0, m_bindGroups[frameIndex].get(), {});
-
-    // Bind particle buffer as vertex buffer (instanced)
-    encoder->setVertexBuffer(0, particleBuffer, 0);
-
-    // Draw particles (6 vertices per particle for quad)
-    encoder->draw(6, particleCount, 0, 0);
-}
+    // Draw 6 vertices per particle (quad). Sorted alpha-blended particles go
+    // first so additive particles brighten whatever smoke lies behind them.
+    auto drawRange = [&](BlendMode mode, uint32_t first, uint32_t count) {
+        if (count == 0) return;
+        encoder->setPipeline(m_pipelines[static_cast<size_t>(mode)].get());
+        encoder->setBindGroup(0, m_bindGroups[frameIndex].get(), {});
+        encoder->setVertexBuffer(0, particleBuffer, 0);
+        encoder->draw(6, count, 0, first);
+    };
 
-void ParticleRenderer::setBlendMode(BlendMode mode) {
-    m_blendMode = mode;
-    // Note: Pipeline needs to be recreated to apply new blend mode
+    drawRange(BlendMode::AlphaBlend, 0, alphaCount);
+    drawRange(BlendMode::Additive, alphaCount, particleCount - alphaCount);
 }
 
 } // namespace effects
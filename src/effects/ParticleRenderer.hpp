@@ -11,7 +11,8 @@ namespace effects {
  * @brief Renders particles using billboard quads
  *
  * Creates GPU resources for particle rendering and handles
- * the draw calls for all active particles.
+ * the draw calls for all active particles. One pipeline per blend mode:
+ * the sorted alpha-blended range is drawn first, then the additive range.
  */
 class ParticleRenderer {
 public:
@@ -50,25 +51,25 @@ public:
                 uint32_t frameIndex);
 
     /**
-     * @brief Get pipeline for external use
+     * @brief Blend mode (selected per emitter via EmitterConfig::blendMode)
      */
-    rhi::RHIRenderPipeline* getPipeline() const { return m_pipeline.get(); }
+    using BlendMode = ParticleBlendMode;
 
     /**
-     * @brief Set blend mode
+     * @brief Get pipeline for external use
      */
-    enum class BlendMode {
-        Alpha,      // Standard alpha blending
-        Additive    // Additive blending (for fire, glow effects)
-    };
-    void setBlendMode(BlendMode mode);
+    rhi::RHIRenderPipeline* getPipeline(BlendMode mode = BlendMode::Additive) const {
+        return m_pipelines[static_cast<size_t>(mode)].get();
+    }
 
 private:
     bool createShaders();
+    bool createPipelineLayout();
     bool createPipeline(rhi::TextureFormat colorFormat, rhi::TextureFormat depthFormat,
-                        void* nativeRenderPass);
+                        void* nativeRenderPass, BlendMode blendMode);
     bool createUniformBuffers();
-    bool createBindGroups();
+    bool createBindGroupLayout();
+    bool updateBindGroup(uint32_t frameIndex, rhi::RHIBuffer* originBuffer);
 
     rhi::RHIDevice* m_device;
     rhi::RHIQueue* m_queue;
@@ -80,20 +81,19 @@ private:
     // Pipeline
     std::unique_ptr<rhi::RHIBindGroupLayout> m_bindGroupLayout;
     std::unique_ptr<rhi::RHIPipelineLayout> m_pipelineLayout;
-    std::unique_ptr<rhi::RHIRenderPipeline> m_pipeline;
+    static constexpr size_t BLEND_MODE_COUNT = 2;
+    std::unique_ptr<rhi::RHIRenderPipeline> m_pipelines[BLEND_MODE_COUNT];
 
     // Per-frame uniform buffers
     static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
     std::unique_ptr<rhi::RHIBuffer> m_uniformBuffers[MAX_FRAMES_IN_FLIGHT];
     std::unique_ptr<rhi::RHIBindGroup> m_bindGroups[MAX_FRAMES_IN_FLIGHT];
+    rhi::RHIBuffer* m_boundOriginBuffers[MAX_FRAMES_IN_FLIGHT] = {};  // Rebuild bind group when it changes
 
     // Camera matrices
     glm::mat4 m_viewMatrix{1.0f};
     glm::mat4 m_projMatrix{1.0f};
 
-    // Current blend mode
-    BlendMode m_blendMode = BlendMode::Additive;
-
     // Uniform buffer structure
     struct UniformData {
         glm::mat4 model;
@@ -0,0 +1,114 @@
+#include "ParticleSorter.hpp"
+#include "src/utils/ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace effects {
+
+ParticleSorter::ParticleSorter(ThreadPool* threadPool)
+    : m_threadPool(threadPool)
+{
+}
+
+void ParticleSorter::clear() {
+    m_keys.clear();
+}
+
+uint32_t ParticleSorter::depthToKey(float depth) {
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+
+    // Standard float flip: negative values invert all bits, positive flip the sign,
+    // giving an unsigned key that ascends with depth. Invert it so farthest sorts first.
+    uint32_t mask = (bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;
+    return ~(bits ^ mask);
+}
+
+void ParticleSorter::sort() {
+    auto startTime = std::chrono::steady_clock::now();
+
+    const uint32_t count = size();
+    m_order.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        m_order[i] = i;
+    }
+
+    if (count > 1) {
+        m_keysScratch.resize(count);
+        m_orderScratch.resize(count);
+
+        uint32_t chunkCount = 1;
+        if (m_threadPool && count >= MIN_PARALLEL_CHUNK * 2) {
+            chunkCount = std::min(m_threadPool->getConcurrency(), count / MIN_PARALLEL_CHUNK);
+        }
+        m_histograms.resize(static_cast<size_t>(chunkCount) * RADIX_SIZE);
+
+        uint32_t* keysIn = m_keys.data();
+        uint32_t* keysOut = m_keysScratch.data();
+        uint32_t* orderIn = m_order.data();
+        uint32_t* orderOut = m_orderScratch.data();
+        uint32_t* histograms = m_histograms.data();
+
+        auto forEachChunk = [&](const ThreadPool::ChunkFn& fn) {
+            if (chunkCount > 1) {
+                m_threadPool->parallelFor(count, chunkCount, fn);
+            } else {
+                fn(0, 0, count);
+            }
+        };
+
+        for (uint32_t pass = 0; pass < PASS_COUNT; ++pass) {
+            const uint32_t shift = pass * RADIX_BITS;
+
+            // Per-chunk digit histograms
+            forEachChunk([&](uint32_t chunk, uint32_t begin, uint32_t end) {
+                uint32_t* histogram = histograms + static_cast<size_t>(chunk) * RADIX_SIZE;
+                std::fill(histogram, histogram + RADIX_SIZE, 0u);
+                for (uint32_t i = begin; i < end; ++i) {
+                    histogram[(keysIn[i] >> shift) & (RADIX_SIZE - 1)]++;
+                }
+            });
+
+            // Exclusive prefix sum, digit-major then chunk, so the scatter stays stable.
+            // A digit holding every key means this pass would be an identity permutation.
+            bool skipPass = false;
+            uint32_t offset = 0;
+            for (uint32_t digit = 0; digit < RADIX_SIZE && !skipPass; ++digit) {
+                uint32_t digitTotal = 0;
+                for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+                    uint32_t& bucket = histograms[static_cast<size_t>(chunk) * RADIX_SIZE + digit];
+                    uint32_t bucketCount = bucket;
+                    bucket = offset;
+                    offset += bucketCount;
+                    digitTotal += bucketCount;
+                }
+                skipPass = (digitTotal == count);
+            }
+            if (skipPass) continue;
+
+            // Scatter into the ping-pong buffers
+            forEachChunk([&](uint32_t chunk, uint32_t begin, uint32_t end) {
+                uint32_t* histogram = histograms + static_cast<size_t>(chunk) * RADIX_SIZE;
+                for (uint32_t i = begin; i < end; ++i) {
+                    uint32_t destination = histogram[(keysIn[i] >> shift) & (RADIX_SIZE - 1)]++;
+                    keysOut[destination] = keysIn[i];
+                    orderOut[destination] = orderIn[i];
+                }
+            });
+
+            std::swap(keysIn, keysOut);
+            std::swap(orderIn, orderOut);
+        }
+
+        // Odd number of executed passes leaves the result in scratch
+        if (orderIn != m_order.data()) {
+            std::memcpy(m_order.data(), orderIn, count * sizeof(uint32_t));
+        }
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    m_lastSortMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+}
+
+} // namespace effects
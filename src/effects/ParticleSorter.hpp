@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+namespace effects {
+
+/**
+ * @brief Back-to-front ordering for alpha-blended particles
+ *
+ * LSD radix sort (4 x 8-bit digits) over order-preserving uint32 keys derived
+ * from view depth. Particles are identified by insertion index; the caller
+ * maps indices back to its own particle references. Large inputs build
+ * per-chunk histograms and scatter in parallel on a ThreadPool; digits shared
+ * by every key are skipped. Scratch arrays persist between frames so
+ * steady-state sorting never allocates.
+ */
+class ParticleSorter {
+public:
+    explicit ParticleSorter(ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Drop particles queued for the previous sort
+     */
+    void clear();
+
+    /**
+     * @brief Queue a particle by its distance along the view direction
+     *
+     * The particle's insertion index is what at() later returns.
+     */
+    void add(float viewDepth) { m_keys.push_back(depthToKey(viewDepth)); }
+
+    /**
+     * @brief Sort queued particles farthest first
+     */
+    void sort();
+
+    /**
+     * @brief Number of queued particles
+     */
+    uint32_t size() const { return static_cast<uint32_t>(m_keys.size()); }
+
+    /**
+     * @brief Insertion index of the particle at sorted position (valid after sort())
+     */
+    uint32_t at(uint32_t sortedIndex) const { return m_order[sortedIndex]; }
+
+    /**
+     * @brief CPU time spent in the last sort() call
+     */
+    float getLastSortMs() const { return m_lastSortMs; }
+
+private:
+    static constexpr uint32_t RADIX_BITS = 8;
+    static constexpr uint32_t RADIX_SIZE = 1u << RADIX_BITS;
+    static constexpr uint32_t PASS_COUNT = 32 / RADIX_BITS;
+    static constexpr uint32_t MIN_PARALLEL_CHUNK = 16384;  // Below this, threads cost more than they save
+
+    /**
+     * @brief Map depth to a key whose ascending order is descending depth
+     */
+    static uint32_t depthToKey(float depth);
+
+    ThreadPool* m_threadPool;
+
+    std::vector<uint32_t> m_keys;
+    std::vector<uint32_t> m_order;
+
+    // Ping-pong and histogram scratch
+    std::vector<uint32_t> m_keysScratch;
+    std::vector<uint32_t> m_orderScratch;
+    std::vector<uint32_t> m_histograms;  // chunkCount * RADIX_SIZE
+
+    float m_lastSortMs = 0.0f;
+};
+
+} // namespace effects
@@ -1,6 +1,11 @@
 #include "ParticleSystem.hpp"
+#include "src/utils/Simd.hpp"
+#include <glm/gtc/packing.hpp>
+#include "src/utils/ThreadPool.hpp"
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <limits>
 
 namespace effects {
 
@@ -10,55 +15,197 @@ namespace effects {
 
 ParticleEmitter::ParticleEmitter(uint32_t maxParticles, const EmitterConfig& config)
     : m_config(config)
+    , m_streamStride(simd::padCount(maxParticles))
     , m_maxParticles(maxParticles)
     , m_rng(std::random_device{}())
 {
-    m_particles.resize(maxParticles);
+    m_streams.assign(static_cast<size_t>(StreamCount) * m_streamStride, 0.0f);
+    updateBounds(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f);
 }
 
-void ParticleEmitter::update(float deltaTime) {
+void ParticleEmitter::reset(uint32_t maxParticles, const EmitterConfig& config) {
+    m_config = config;
+    m_maxParticles = maxParticles;
+    m_streamStride = simd::padCount(maxParticles);
+    m_streams.resize(static_cast<size_t>(StreamCount) * m_streamStride);  // Keeps capacity
+
     m_activeCount = 0;
+    m_emissionAccumulator = 0.0f;
+    m_enabled = true;
+
+    m_emissionScale = 1.0f;
+    m_sizeScale = 1.0f;
+    m_deferredTime = 0.0f;
+    m_visible = true;
+
+    m_effectType = ParticleEffectType::Custom;
+    m_priority = 1.0f;
+    m_fillCost = 0.0f;
+    updateBounds(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f);
+}
 
-    for (auto& particle : m_particles) {
-        if (!particle.isAlive()) continue;
+void ParticleEmitter::update(float deltaTime) {
+    float* posX = stream(PositionX);
+    float* posY = stream(PositionY);
+    float* posZ = stream(PositionZ);
+    float* velX = stream(VelocityX);
+    float* velY = stream(VelocityY);
+    float* velZ = stream(VelocityZ);
+    float* lifetimes = stream(Lifetime);
+    float* ages = stream(Age);
+    float* colorR = stream(ColorR);
+    float* colorG = stream(ColorG);
+    float* colorB = stream(ColorB);
+    float* colorA = stream(ColorA);
+    float* rotations = stream(Rotation);
+    const float* rotationSpeeds = stream(RotationSpeed);
+
+    const simd::Float dt(deltaTime);
+    const simd::Float zero(0.0f);
+    const simd::Float damping(1.0f - m_config.drag * deltaTime);
+    const simd::Float gravityX(m_config.gravity.x * deltaTime);
+    const simd::Float gravityY(m_config.gravity.y * deltaTime);
+    const simd::Float gravityZ(m_config.gravity.z * deltaTime);
+
+    const glm::vec4 colorDelta = m_config.endColor - m_config.startColor;
+    const simd::Float startR(m_config.startColor.r), deltaR(colorDelta.r);
+    const simd::Float startG(m_config.startColor.g), deltaG(colorDelta.g);
+    const simd::Float startB(m_config.startColor.b), deltaB(colorDelta.b);
+    const simd::Float startA(m_config.startColor.a), deltaA(colorDelta.a);
+
+    // Integrate the dense live range. The last step may run past m_activeCount
+    // into padding / dead slots; those lanes are never read back.
+    for (uint32_t i = 0; i < m_activeCount; i += simd::Float::Width) {
+        simd::Float lifetime = simd::Float::load(lifetimes + i) - dt;
+        simd::Float age = simd::Float::load(ages + i) + dt;
+        lifetime.store(lifetimes + i);
+        age.store(ages + i);
 
-        // Update lifetime
-        particle.lifetime -= deltaTime;
-        particle.age += deltaTime;
+        // Apply physics
+        simd::Float vx = (simd::Float::load(velX + i) + gravityX) * damping;
+        simd::Float vy = (simd::Float::load(velY + i) + gravityY) * damping;
+        simd::Float vz = (simd::Float::load(velZ + i) + gravityZ) * damping;
+        vx.store(velX + i);
+        vy.store(velY + i);
+        vz.store(velZ + i);
+        fma(vx, dt, simd::Float::load(posX + i)).store(posX + i);
+        fma(vy, dt, simd::Float::load(posY + i)).store(posY + i);
+        fma(vz, dt, simd::Float::load(posZ + i)).store(posZ + i);
 
-        if (particle.lifetime <= 0.0f) {
-            particle.lifetime = 0.0f;
+        // Update rotation
+        fma(simd::Float::load(rotationSpeeds + i), dt, simd::Float::load(rotations + i)).store(rotations + i);
+
+        // Update color based on normalized age (1 once expired)
+        simd::Float t = age / (age + max(lifetime, zero));
+        fma(deltaR, t, startR).store(colorR + i);
+        fma(deltaG, t, startG).store(colorG + i);
+        fma(deltaB, t, startB).store(colorB + i);
+        fma(deltaA, t, startA).store(colorA + i);
+    }
+
+    // Retire expired particles (swap-remove keeps the live range dense) and
+    // gather bounds from the survivors
+    const float* sizeX = stream(SizeX);
+    const float* sizeY = stream(SizeY);
+    glm::vec3 particleMin(std::numeric_limits<float>::max());
+    glm::vec3 particleMax(std::numeric_limits<float>::lowest());
+    float maxHalfSize = 0.0f;
+
+    for (uint32_t i = 0; i < m_activeCount;) {
+        if (lifetimes[i] <= 0.0f) {
+            removeParticle(i);
             continue;
         }
 
-        // Apply physics
-        particle.velocity += m_config.gravity * deltaTime;
-        particle.velocity *= (1.0f - m_config.drag * deltaTime);
-        particle.position += particle.velocity * deltaTime;
+        glm::vec3 position(posX[i], posY[i], posZ[i]);
+        particleMin = glm::min(particleMin, position);
+        particleMax = glm::max(particleMax, position);
+        maxHalfSize = std::max(maxHalfSize, 0.5f * std::max(sizeX[i], sizeY[i]));
+        ++i;
+    }
 
-        // Update rotation
-        particle.rotation += particle.rotationSpeed * deltaTime;
+    updateBounds(particleMin, particleMax, maxHalfSize);
+}
 
-        // Update color based on age
-        float t = particle.normalizedAge();
-        particle.color = glm::mix(m_config.startColor, m_config.endColor, t);
+void ParticleEmitter::removeParticle(uint32_t index) {
+    uint32_t last = --m_activeCount;
+    if (index == last) return;
 
-        m_activeCount++;
+    for (uint32_t s = 0; s < StreamCount; ++s) {
+        float* data = stream(static_cast<Stream>(s));
+        data[index] = data[last];
     }
 }
 
+void ParticleEmitter::writeVertex(uint32_t index, uint16_t emitterIndex, ParticleVertex& out) const {
+    auto toUnorm8 = [](float value) {
+        return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+
+    glm::vec3 offset = getParticlePosition(index) - m_config.position;
+    out.offset[0] = glm::packHalf1x16(offset.x);
+    out.offset[1] = glm::packHalf1x16(offset.y);
+    out.offset[2] = glm::packHalf1x16(offset.z);
+    out.emitterIndex = emitterIndex;
+    out.size[0] = glm::packHalf1x16(stream(SizeX)[index]);
+    out.size[1] = glm::packHalf1x16(stream(SizeY)[index]);
+    out.color[0] = toUnorm8(stream(ColorR)[index]);
+    out.color[1] = toUnorm8(stream(ColorG)[index]);
+    out.color[2] = toUnorm8(stream(ColorB)[index]);
+    out.color[3] = toUnorm8(stream(ColorA)[index]);
+
+    float turns = stream(Rotation)[index] / 360.0f;
+    out.rotation = toUnorm8(turns - std::floor(turns));
+}
+
+Particle ParticleEmitter::getParticle(uint32_t index) const {
+    Particle particle;
+    particle.position = getParticlePosition(index);
+    particle.lifetime = stream(Lifetime)[index];
+    particle.velocity = glm::vec3(stream(VelocityX)[index], stream(VelocityY)[index], stream(VelocityZ)[index]);
+    particle.age = stream(Age)[index];
+    particle.color = glm::vec4(stream(ColorR)[index], stream(ColorG)[index],
+                               stream(ColorB)[index], stream(ColorA)[index]);
+    particle.size = glm::vec2(stream(SizeX)[index], stream(SizeY)[index]);
+    particle.rotation = stream(Rotation)[index];
+    particle.rotationSpeed = stream(RotationSpeed)[index];
+    return particle;
+}
+
+void ParticleEmitter::updateBounds(const glm::vec3& particleMin, const glm::vec3& particleMax,
+                                   float maxHalfSize) {
+    // Spawn volume: where the next particles will appear
+    glm::vec3 spawnExtent(0.0f);
+    if (m_config.shape == EmitterConfig::Shape::Sphere) {
+        spawnExtent = glm::vec3(m_config.sphereRadius);
+    } else if (m_config.shape == EmitterConfig::Shape::Box) {
+        spawnExtent = m_config.boxExtents;
+    }
+    m_bounds = scene::AABB(m_config.position - spawnExtent, m_config.position + spawnExtent);
+
+    if (m_activeCount > 0) {
+        m_bounds.expand(scene::AABB(particleMin, particleMax));
+    }
+
+    // Pad by the largest billboard (live particles or the next spawn)
+    float spawnHalfSize = 0.5f * std::max(m_config.maxSize.x, m_config.maxSize.y) * m_sizeScale;
+    glm::vec3 padding(std::max(maxHalfSize, spawnHalfSize));
+    m_bounds.min -= padding;
+    m_bounds.max += padding;
+}
+
 void ParticleEmitter::emit(float deltaTime) {
     if (!m_enabled) return;
 
     if (m_config.burstMode) {
-        // Burst mode: emit all at once, then disable
-        burst(m_config.burstCount);
+        // Burst mode: emit all at once (scaled by distance LOD), then disable
+        burst(static_cast<uint32_t>(std::ceil(m_config.burstCount * m_emissionScale)));
         m_enabled = false;
         return;
     }
 
     // Continuous emission
-    m_emissionAccumulator += m_config.emissionRate * deltaTime;
+    m_emissionAccumulator += m_config.emissionRate * m_emissionScale * deltaTime;
 
     while (m_emissionAccumulator >= 1.0f) {
         spawnParticle();
@@ -73,26 +220,29 @@ void ParticleEmitter::burst(uint32_t count) {
 }
 
 void ParticleEmitter::spawnParticle() {
-    // Find dead particle slot
-    for (auto& particle : m_particles) {
-        if (particle.isAlive()) continue;
-
-        // Initialize particle
-        particle.position = m_config.position + randomPositionInShape();
-        particle.velocity = randomVelocity();
-        particle.lifetime = randomFloat(m_config.minLifetime, m_config.maxLifetime);
-        particle.age = 0.0f;
-        particle.color = m_config.startColor;
-        particle.size = glm::vec2(
-            randomFloat(m_config.minSize.x, m_config.maxSize.x),
-            randomFloat(m_config.minSize.y, m_config.maxSize.y)
-        );
-        particle.rotation = randomFloat(0.0f, 360.0f);
-        particle.rotationSpeed = randomFloat(m_config.minRotationSpeed, m_config.maxRotationSpeed);
-
-        m_activeCount++;
-        return;
-    }
+    // Append to the dense live range; a full pool drops the spawn
+    if (m_activeCount >= m_maxParticles) return;
+    uint32_t i = m_activeCount++;
+
+    // Initialize particle
+    glm::vec3 position = m_config.position + randomPositionInShape();
+    glm::vec3 velocity = randomVelocity();
+    stream(PositionX)[i] = position.x;
+    stream(PositionY)[i] = position.y;
+    stream(PositionZ)[i] = position.z;
+    stream(VelocityX)[i] = velocity.x;
+    stream(VelocityY)[i] = velocity.y;
+    stream(VelocityZ)[i] = velocity.z;
+    stream(Lifetime)[i] = randomFloat(m_config.minLifetime, m_config.maxLifetime);
+    stream(Age)[i] = 0.0f;
+    stream(ColorR)[i] = m_config.startColor.r;
+    stream(ColorG)[i] = m_config.startColor.g;
+    stream(ColorB)[i] = m_config.startColor.b;
+    stream(ColorA)[i] = m_config.startColor.a;
+    stream(SizeX)[i] = randomFloat(m_config.minSize.x, m_config.maxSize.x) * m_sizeScale;
+    stream(SizeY)[i] = randomFloat(m_config.minSize.y, m_config.maxSize.y) * m_sizeScale;
+    stream(Rotation)[i] = randomFloat(0.0f, 360.0f);
+    stream(RotationSpeed)[i] = randomFloat(m_config.minRotationSpeed, m_config.maxRotationSpeed);
 }
 
 glm::vec3 ParticleEmitter::randomPositionInShape() {
@@ -196,32 +346,56 @@ glm::vec3 ParticleEmitter::randomInCone(const glm::vec3& direction, float angle)
 ParticleSystem::ParticleSystem(rhi::RHIDevice* device, rhi::RHIQueue* queue)
     : m_device(device)
     , m_queue(queue)
+    , m_sorter(&ThreadPool::shared())
 {
 }
 
 ParticleSystem::~ParticleSystem() = default;
 
-uint32_t ParticleSystem::createEmitter(uint32_t maxParticles, const EmitterConfig& config) {
-    auto emitter = std::make_unique<ParticleEmitter>(maxParticles, config);
-    m_emitters.push_back(std::move(emitter));
-    return m_nextEmitterId++;
+EmitterHandle ParticleSystem::createEmitter(uint32_t maxParticles, const EmitterConfig& config) {
+    std::unique_ptr<ParticleEmitter> emitter;
+    if (!m_emitterPool.empty()) {
+        emitter = std::move(m_emitterPool.back());
+        m_emitterPool.pop_back();
+        emitter->reset(maxParticles, config);
+    } else {
+        emitter = std::make_unique<ParticleEmitter>(maxParticles, config);
+    }
+
+    // Direct creations bypass admission but still count against the budget
+    float fillCost = estimateFillCost(config, maxParticles);
+    emitter->setAdmission(ParticleEffectType::Custom, 1.0f, fillCost);
+    m_budgetStats.reservedParticles += maxParticles;
+    m_budgetStats.emitters++;
+    m_budgetStats.fillScreens += fillCost;
+
+    return m_emitters.emplace(std::move(emitter));
 }
 
-uint32_t ParticleSystem::createEmitter(uint32_t maxParticles, ParticleEffectType effectType) {
+EmitterHandle ParticleSystem::createEmitter(uint32_t maxParticles, ParticleEffectType effectType) {
     return createEmitter(maxParticles, createEffectConfig(effectType));
 }
 
-void ParticleSystem::removeEmitter(uint32_t emitterId) {
-    if (emitterId < m_emitters.size()) {
-        m_emitters.erase(m_emitters.begin() + emitterId);
-    }
+void ParticleSystem::removeEmitter(EmitterHandle handle) {
+    recycleEmitter(handle);
+}
+
+ParticleEmitter* ParticleSystem::getEmitter(EmitterHandle handle) {
+    auto* emitter = m_emitters.get(handle);
+    return emitter ? emitter->get() : nullptr;
 }
 
-ParticleEmitter* ParticleSystem::getEmitter(uint32_t emitterId) {
-    if (emitterId < m_emitters.size()) {
-        return m_emitters[emitterId].get();
+void ParticleSystem::recycleEmitter(EmitterHandle handle) {
+    std::unique_ptr<ParticleEmitter> emitter;
+    if (!m_emitters.erase(handle, &emitter)) return;
+
+    m_budgetStats.reservedParticles -= emitter->getMaxParticles();
+    m_budgetStats.emitters--;
+    m_budgetStats.fillScreens = std::max(m_budgetStats.fillScreens - emitter->getFillCost(), 0.0f);
+
+    if (m_emitterPool.size() < MAX_POOLED_EMITTERS) {
+        m_emitterPool.push_back(std::move(emitter));
     }
-    return nullptr;
 }
 
 void ParticleSystem::update(float deltaTime) {
@@ -230,7 +404,7 @@ void ParticleSystem::update(float deltaTime) {
         it->remainingTime -= deltaTime;
         if (it->remainingTime <= 0.0f) {
             // Disable emission but let existing particles fade
-            if (auto* emitter = getEmitter(it->emitterId)) {
+            if (auto* emitter = getEmitter(it->emitter)) {
                 emitter->setEnabled(false);
             }
             it = m_timedEffects.erase(it);
@@ -239,51 +413,213 @@ void ParticleSystem::update(float deltaTime) {
         }
     }
 
-    // Update all emitters
-    for (auto& emitter : m_emitters) {
-        emitter->emit(deltaTime);
-        emitter->update(deltaTime);
+    // Update all emitters. They share no mutable state, so chunks of the dense
+    // emitter array run in parallel.
+    ++m_frameCounter;
+    const uint32_t emitterCount = static_cast<uint32_t>(m_emitters.size());
+    auto updateRange = [&](uint32_t /*chunk*/, uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            stepEmitter(*m_emitters[i], i, deltaTime);
+        }
+    };
+
+    if (emitterCount >= PARALLEL_UPDATE_MIN_EMITTERS) {
+        // Several chunks per thread to balance emitters of very different sizes
+        ThreadPool& pool = ThreadPool::shared();
+        pool.parallelFor(emitterCount, pool.getConcurrency() * 4, updateRange);
+    } else {
+        updateRange(0, 0, emitterCount);
     }
 
-    // Remove emitters with no active particles and disabled
-    m_emitters.erase(
-        std::remove_if(m_emitters.begin(), m_emitters.end(),
-            [](const std::unique_ptr<ParticleEmitter>& e) {
-                return !e->isEnabled() && !e->hasActiveParticles();
-            }),
-        m_emitters.end()
-    );
+    // Gather culling stats and recycle disabled emitters with no active particles
+    m_cullingStats = {};
+    for (size_t i = m_emitters.size(); i-- > 0;) {
+        const ParticleEmitter& emitter = *m_emitters[i];
+        if (!emitter.isEnabled() && !emitter.hasActiveParticles()) {
+            recycleEmitter(m_emitters.handleAt(i));
+            continue;
+        }
+
+        if (emitter.isVisible()) {
+            m_cullingStats.visibleEmitters++;
+        } else {
+            m_cullingStats.culledEmitters++;
+        }
+        if (emitter.getEmissionScale() <= 0.0f) {
+            m_cullingStats.distantEmitters++;
+        }
+    }
+
+    // Re-derive budget usage from the survivors so float error cannot accumulate
+    m_budgetStats.reservedParticles = 0;
+    m_budgetStats.emitters = static_cast<uint32_t>(m_emitters.size());
+    m_budgetStats.fillScreens = 0.0f;
+    for (const auto& emitter : m_emitters) {
+        m_budgetStats.reservedParticles += emitter->getMaxParticles();
+        m_budgetStats.fillScreens += emitter->getFillCost();
+    }
+}
+
+void ParticleSystem::stepEmitter(ParticleEmitter& emitter, size_t denseIndex, float deltaTime) const {
+    // Off-screen emitters run a coarse simulation: they step every
+    // offscreenUpdateInterval frames (staggered by index) with the skipped time.
+    if (m_hasCamera && m_cullingSettings.enabled) {
+        applyLod(emitter);
+        const uint32_t interval = std::max(m_cullingSettings.offscreenUpdateInterval, 1u);
+        if (!emitter.isVisible() && (m_frameCounter + denseIndex) % interval != 0) {
+            emitter.deferTime(deltaTime);
+            return;
+        }
+    } else {
+        emitter.setVisible(true);
+        emitter.setLod(1.0f, 1.0f);
+    }
+
+    float stepTime = emitter.consumeDeferredTime() + deltaTime;
+    emitter.emit(stepTime);
+    emitter.update(stepTime);
+}
+
+void ParticleSystem::setCamera(const glm::mat4& view, const glm::mat4& projection,
+                               const glm::vec3& position) {
+    m_frustum.update(view, projection);
+    m_cameraPosition = position;
+    m_projectedAreaScale = std::abs(projection[0][0] * projection[1][1]);
+    m_hasCamera = true;
+}
+
+void ParticleSystem::applyLod(ParticleEmitter& emitter) const {
+    const scene::AABB& bounds = emitter.getBounds();
+    emitter.setVisible(m_frustum.intersectsAABB(bounds));
+
+    // Distance from the camera to the nearest point of the bounds
+    glm::vec3 nearest = glm::clamp(m_cameraPosition, bounds.min, bounds.max);
+    float distance = glm::length(nearest - m_cameraPosition);
+
+    const auto& settings = m_cullingSettings;
+    float emissionScale = 1.0f;
+    if (distance >= settings.maxEmitDistance) {
+        emissionScale = 0.0f;
+    } else if (distance > settings.fullDetailDistance) {
+        float t = (distance - settings.fullDetailDistance) /
+                  (settings.maxEmitDistance - settings.fullDetailDistance);
+        emissionScale = glm::mix(1.0f, settings.minEmissionScale, t);
+    }
+
+    // Fewer, larger particles keep the effect's screen coverage roughly constant
+    float sizeScale = 1.0f;
+    if (emissionScale > 0.0f) {
+        sizeScale = std::min(1.0f / std::sqrt(emissionScale), settings.maxSizeScale);
+    }
+    emitter.setLod(emissionScale, sizeScale);
 }
 
-void ParticleSystem::uploadToGPU() {
-    collectParticlesForGPU();
+void ParticleSystem::uploadToGPU(uint32_t frameIndex, const glm::mat4& view) {
+    ++m_uploadCounter;
+    releaseRetiredBuffers();
 
-    if (m_collectedParticles.empty()) return;
+    FrameResources& frame = m_frames[frameIndex % MAX_FRAMES_IN_FLIGHT];
+    frame.uploadedCount = 0;
+    frame.alphaCount = 0;
 
-    uint32_t requiredSize = static_cast<uint32_t>(m_collectedParticles.size());
+    uint32_t requiredCount = getTotalActiveParticles();
 
-    // Recreate buffer if needed
-    if (requiredSize > m_gpuBufferCapacity) {
-        createGPUBuffers(requiredSize * 2);  // Double capacity for growth
+    // Grow this frame's buffer if needed (double capacity for growth). The old
+    // buffer may still be referenced by an in-flight command buffer, so it is
+    // retired rather than destroyed.
+    if (requiredCount > frame.capacity || !frame.particleBuffer) {
+        if (frame.particleBuffer) {
+            m_retiredBuffers.push_back({std::move(frame.particleBuffer), m_uploadCounter});
+        }
+        createGPUBuffers(frame, std::max(requiredCount * 2, 256u));
     }
 
-    // Upload data
-    if (m_particleBuffer) {
-        void* mapped = m_particleBuffer->map();
+    // Assign origin buffer slots to the emitters drawn this frame
+    m_uploadEmitters.clear();
+    for (const auto& emitter : m_emitters) {
+        if (!emitter->isVisible() || !emitter->hasActiveParticles()) continue;
+        if (m_uploadEmitters.size() == MAX_UPLOAD_EMITTERS) break;
+        m_uploadEmitters.push_back(emitter.get());
+    }
+    const uint32_t emitterCount = static_cast<uint32_t>(m_uploadEmitters.size());
+
+    if (emitterCount > frame.originCapacity || !frame.originBuffer) {
+        if (frame.originBuffer) {
+            m_retiredBuffers.push_back({std::move(frame.originBuffer), m_uploadCounter});
+        }
+        createOriginBuffer(frame, std::max(emitterCount * 2, 64u));
+    }
+
+    // Depth-sort alpha-blended particles (distance along the view direction)
+    m_sorter.clear();
+    m_sortRefs.clear();
+    glm::vec3 viewAxis(view[0][2], view[1][2], view[2][2]);
+    float viewOffset = view[3][2];
+    for (uint32_t e = 0; e < emitterCount; ++e) {
+        const ParticleEmitter* emitter = m_uploadEmitters[e];
+        if (emitter->getConfig().blendMode != ParticleBlendMode::AlphaBlend) continue;
+        for (uint32_t i = 0; i < emitter->getActiveCount(); ++i) {
+            m_sorter.add(-(glm::dot(viewAxis, emitter->getParticlePosition(i)) + viewOffset));
+            m_sortRefs.push_back({e, i});
+        }
+    }
+    m_sorter.sort();
+    m_sortStats.sortedCount = m_sorter.size();
+    m_sortStats.cpuMs = m_sorter.getLastSortMs();
+
+    // Emitter origins (xyz, w unused)
+    if (emitterCount > 0 && frame.originBuffer) {
+        void* mapped = frame.originMapped ? frame.originMapped : frame.originBuffer->map();
         if (mapped) {
-            std::memcpy(mapped, m_collectedParticles.data(),
-                       m_collectedParticles.size() * sizeof(Particle));
-            m_particleBuffer->unmap();
+            auto* origins = static_cast<glm::vec4*>(mapped);
+            for (uint32_t e = 0; e < emitterCount; ++e) {
+                origins[e] = glm::vec4(m_uploadEmitters[e]->getPosition(), 0.0f);
+            }
+            if (!frame.originMapped) {
+                frame.originBuffer->unmap();
+            }
+        }
+    }
+
+    // Pack live particles straight into mapped memory: sorted alpha first, then additive
+    if (requiredCount > 0 && frame.particleBuffer) {
+        void* mapped = frame.particleMapped ? frame.particleMapped : frame.particleBuffer->map();
+        if (mapped) {
+            auto* dst = static_cast<ParticleVertex*>(mapped);
+            uint32_t written = 0;
+
+            uint32_t sortedCount = std::min(m_sorter.size(), frame.capacity);
+            for (uint32_t i = 0; i < sortedCount; ++i) {
+                const SortRef& ref = m_sortRefs[m_sorter.at(i)];
+                m_uploadEmitters[ref.emitterIndex]->writeVertex(
+                    ref.index, static_cast<uint16_t>(ref.emitterIndex), dst[written++]);
+            }
+            frame.alphaCount = written;
+
+            for (uint32_t e = 0; e < emitterCount; ++e) {
+                const ParticleEmitter* emitter = m_uploadEmitters[e];
+                if (emitter->getConfig().blendMode == ParticleBlendMode::AlphaBlend) continue;
+                uint32_t count = std::min(emitter->getActiveCount(), frame.capacity - written);
+                for (uint32_t i = 0; i < count; ++i) {
+                    emitter->writeVertex(i, static_cast<uint16_t>(e), dst[written++]);
+                }
+            }
+
+            if (!frame.particleMapped) {
+                frame.particleBuffer->unmap();
+            }
+            frame.uploadedCount = written;
         }
     }
 
     // Update count buffer
-    if (m_countBuffer) {
-        uint32_t count = static_cast<uint32_t>(m_collectedParticles.size());
-        void* mapped = m_countBuffer->map();
+    if (frame.countBuffer) {
+        void* mapped = frame.countMapped ? frame.countMapped : frame.countBuffer->map();
         if (mapped) {
-            std::memcpy(mapped, &count, sizeof(uint32_t));
-            m_countBuffer->unmap();
+            std::memcpy(mapped, &frame.uploadedCount, sizeof(uint32_t));
+            if (!frame.countMapped) {
+                frame.countBuffer->unmap();
+            }
         }
     }
 }
@@ -296,7 +632,8 @@ uint32_t ParticleSystem::getTotalActiveParticles() const {
     return total;
 }
 
-uint32_t ParticleSystem::spawnEffect(ParticleEffectType effectType, const glm::vec3& position, float duration) {
+EmitterHandle ParticleSystem::spawnEffect(ParticleEffectType effectType, const glm::vec3& position,
+                                          float duration, float priority) {
     EmitterConfig config = createEffectConfig(effectType);
     config.position = position;
 
@@ -307,48 +644,221 @@ uint32_t ParticleSystem::spawnEffect(ParticleEffectType effectType, const glm::v
         maxParticles = 2000;
     }
 
-    uint32_t emitterId = createEmitter(maxParticles, config);
+    float fillCost = estimateFillCost(config, maxParticles);
+    if (m_budgetSettings.enabled) {
+        // Under pressure, fold a repeated event into a live effect of the same kind
+        if (budgetPressure() >= m_budgetSettings.mergePressure) {
+            EmitterHandle target = findMergeTarget(effectType, position);
+            if (ParticleEmitter* emitter = getEmitter(target)) {
+                emitter->setPriority(std::max(emitter->getPriority(), priority));
+                if (config.burstMode) {
+                    emitter->burst(static_cast<uint32_t>(std::ceil(config.burstCount * emitter->getEmissionScale())));
+                }
+                // Keep the merged effect alive for the longer of the two durations
+                for (auto it = m_timedEffects.begin(); it != m_timedEffects.end(); ++it) {
+                    if (it->emitter == target) {
+                        if (duration > 0.0f) {
+                            it->remainingTime = std::max(it->remainingTime, duration);
+                        } else {
+                            m_timedEffects.erase(it);
+                        }
+                        break;
+                    }
+                }
+                m_budgetStats.merged++;
+                return target;
+            }
+        }
+
+        if (!fitsBudget(maxParticles, fillCost) && !evictForBudget(maxParticles, fillCost, priority)) {
+            // Shrink to the remaining budget, or drop when too little is left
+            const BudgetSettings& budget = m_budgetSettings;
+            float fraction = 0.0f;
+            if (m_budgetStats.emitters < budget.maxEmitters && budget.maxParticles > m_budgetStats.reservedParticles) {
+                fraction = static_cast<float>(budget.maxParticles - m_budgetStats.reservedParticles) / maxParticles;
+                if (fillCost > 0.0f) {
+                    fraction = std::min(fraction, (budget.maxFillScreens - m_budgetStats.fillScreens) / fillCost);
+                }
+                fraction = std::min(fraction, 1.0f);
+            }
+
+            if (fraction < budget.minShrinkFraction) {
+                m_budgetStats.dropped++;
+                return EmitterHandle{};
+            }
+
+            maxParticles = std::max(static_cast<uint32_t>(maxParticles * fraction), 1u);
+            config.emissionRate *= fraction;
+            config.burstCount = static_cast<uint32_t>(std::ceil(config.burstCount * fraction));
+            fillCost *= fraction;
+            m_budgetStats.shrunk++;
+        }
+        m_budgetStats.admitted++;
+    }
+
+    EmitterHandle handle = createEmitter(maxParticles, config);
+    if (ParticleEmitter* emitter = getEmitter(handle)) {
+        emitter->setAdmission(effectType, priority, fillCost);
+    }
 
     if (duration > 0.0f) {
-        m_timedEffects.push_back({emitterId, duration});
+        m_timedEffects.push_back({handle, duration});
+    }
+
+    return handle;
+}
+
+float ParticleSystem::estimateFillCost(const EmitterConfig& config, uint32_t maxParticles) const {
+    if (!m_hasCamera) return 0.0f;
+
+    // Steady-state live particles: the burst, or emission rate x mean lifetime
+    float liveParticles = config.burstMode
+        ? static_cast<float>(config.burstCount)
+        : config.emissionRate * 0.5f * (config.minLifetime + config.maxLifetime);
+    liveParticles = std::min(liveParticles, static_cast<float>(maxParticles));
+
+    // Projected quad area relative to the viewport (NDC spans 2 x 2), capped at full screen
+    glm::vec2 meanSize = 0.5f * (config.minSize + config.maxSize);
+    float distance = std::max(glm::length(config.position - m_cameraPosition), 1.0f);
+    float screenFraction = meanSize.x * meanSize.y * m_projectedAreaScale / (distance * distance) * 0.25f;
+
+    return liveParticles * std::min(screenFraction, 1.0f);
+}
+
+EmitterHandle ParticleSystem::findMergeTarget(ParticleEffectType effectType, const glm::vec3& position) const {
+    const float maxDistanceSq = m_budgetSettings.mergeRadius * m_budgetSettings.mergeRadius;
+    EmitterHandle best;
+    float bestDistanceSq = maxDistanceSq;
+    for (size_t i = 0; i < m_emitters.size(); ++i) {
+        const ParticleEmitter& emitter = *m_emitters[i];
+        if (emitter.getEffectType() != effectType) continue;
+        // Finished continuous emitters are only fading out; bursts merge by re-bursting
+        if (!emitter.isEnabled() && !emitter.getConfig().burstMode) continue;
+
+        glm::vec3 delta = emitter.getPosition() - position;
+        float distanceSq = glm::dot(delta, delta);
+        if (distanceSq <= bestDistanceSq) {
+            bestDistanceSq = distanceSq;
+            best = m_emitters.handleAt(i);
+        }
+    }
+    return best;
+}
+
+float ParticleSystem::budgetPressure() const {
+    const BudgetSettings& budget = m_budgetSettings;
+    float pressure = 0.0f;
+    if (budget.maxParticles > 0) {
+        pressure = std::max(pressure, static_cast<float>(m_budgetStats.reservedParticles) / budget.maxParticles);
+    }
+    if (budget.maxEmitters > 0) {
+        pressure = std::max(pressure, static_cast<float>(m_budgetStats.emitters) / budget.maxEmitters);
+    }
+    if (budget.maxFillScreens > 0.0f) {
+        pressure = std::max(pressure, m_budgetStats.fillScreens / budget.maxFillScreens);
+    }
+    return pressure;
+}
+
+bool ParticleSystem::fitsBudget(uint32_t particles, float fillCost) const {
+    const BudgetSettings& budget = m_budgetSettings;
+    return m_budgetStats.emitters + 1 <= budget.maxEmitters &&
+           m_budgetStats.reservedParticles + particles <= budget.maxParticles &&
+           m_budgetStats.fillScreens + fillCost <= budget.maxFillScreens;
+}
+
+bool ParticleSystem::evictForBudget(uint32_t particles, float fillCost, float priority) {
+    // Candidates: strictly lower priority, lowest first
+    m_evictionCandidates.clear();
+    for (uint32_t i = 0; i < m_emitters.size(); ++i) {
+        if (m_emitters[i]->getPriority() < priority) {
+            m_evictionCandidates.push_back(i);
+        }
+    }
+    std::sort(m_evictionCandidates.begin(), m_evictionCandidates.end(), [this](uint32_t a, uint32_t b) {
+        return m_emitters[a]->getPriority() < m_emitters[b]->getPriority();
+    });
+
+    // Find the shortest prefix that makes room; evict nothing if none does
+    const BudgetSettings& budget = m_budgetSettings;
+    uint32_t emitters = m_budgetStats.emitters;
+    uint32_t reserved = m_budgetStats.reservedParticles;
+    float fill = m_budgetStats.fillScreens;
+    size_t evictCount = 0;
+    auto fits = [&] {
+        return emitters + 1 <= budget.maxEmitters && reserved + particles <= budget.maxParticles &&
+               fill + fillCost <= budget.maxFillScreens;
+    };
+    while (!fits() && evictCount < m_evictionCandidates.size()) {
+        const ParticleEmitter& emitter = *m_emitters[m_evictionCandidates[evictCount++]];
+        emitters--;
+        reserved -= emitter.getMaxParticles();
+        fill -= emitter.getFillCost();
     }
+    if (!fits()) return false;
 
-    return emitterId;
+    // Resolve handles first: each erase moves another emitter's dense index
+    std::vector<EmitterHandle> victims;
+    victims.reserve(evictCount);
+    for (size_t i = 0; i < evictCount; ++i) {
+        victims.push_back(m_emitters.handleAt(m_evictionCandidates[i]));
+    }
+    for (EmitterHandle victim : victims) {
+        recycleEmitter(victim);
+    }
+    m_budgetStats.evicted += static_cast<uint32_t>(evictCount);
+    return true;
 }
 
-void ParticleSystem::createGPUBuffers(uint32_t maxParticles) {
-    m_gpuBufferCapacity = maxParticles;
+void ParticleSystem::createGPUBuffers(FrameResources& frame, uint32_t maxParticles) {
+    frame.capacity = maxParticles;
 
-    // Create particle buffer
+    // Create particle buffer (host-visible, persistently mapped where supported)
     rhi::BufferDesc particleBufferDesc;
-    particleBufferDesc.size = maxParticles * sizeof(Particle);
+    particleBufferDesc.size = maxParticles * sizeof(ParticleVertex);
     particleBufferDesc.usage = rhi::BufferUsage::Vertex | rhi::BufferUsage::Storage | rhi::BufferUsage::MapWrite;
     particleBufferDesc.mappedAtCreation = false;
     particleBufferDesc.label = "ParticleBuffer";
 
-    m_particleBuffer = m_device->createBuffer(particleBufferDesc);
+    frame.particleBuffer = m_device->createBuffer(particleBufferDesc);
+    frame.particleMapped = frame.particleBuffer ? frame.particleBuffer->getMappedData() : nullptr;
 
-    // Create count buffer (for indirect rendering)
-    rhi::BufferDesc countBufferDesc;
-    countBufferDesc.size = sizeof(uint32_t) * 4;  // count + padding for indirect args
-    countBufferDesc.usage = rhi::BufferUsage::Uniform | rhi::BufferUsage::Indirect | rhi::BufferUsage::MapWrite;
-    countBufferDesc.mappedAtCreation = false;
-    countBufferDesc.label = "ParticleCountBuffer";
+    // Create count buffer once per frame slot (for indirect rendering)
+    if (!frame.countBuffer) {
+        rhi::BufferDesc countBufferDesc;
+        countBufferDesc.size = sizeof(uint32_t) * 4;  // count + padding for indirect args
+        countBufferDesc.usage = rhi::BufferUsage::Uniform | rhi::BufferUsage::Indirect | rhi::BufferUsage::MapWrite;
+        countBufferDesc.mappedAtCreation = false;
+        countBufferDesc.label = "ParticleCountBuffer";
 
-    m_countBuffer = m_device->createBuffer(countBufferDesc);
+        frame.countBuffer = m_device->createBuffer(countBufferDesc);
+        frame.countMapped = frame.countBuffer ? frame.countBuffer->getMappedData() : nullptr;
+    }
 }
 
-void ParticleSystem::collectParticlesForGPU() {
-    m_collectedParticles.clear();
+void ParticleSystem::createOriginBuffer(FrameResources& frame, uint32_t maxEmitters) {
+    frame.originCapacity = maxEmitters;
 
-    for (const auto& emitter : m_emitters) {
-        const auto& particles = emitter->getParticles();
-        for (const auto& particle : particles) {
-            if (particle.isAlive()) {
-                m_collectedParticles.push_back(particle);
-            }
-        }
-    }
+    rhi::BufferDesc originBufferDesc;
+    originBufferDesc.size = maxEmitters * sizeof(glm::vec4);
+    originBufferDesc.usage = rhi::BufferUsage::Storage | rhi::BufferUsage::MapWrite;
+    originBufferDesc.mappedAtCreation = false;
+    originBufferDesc.label = "ParticleEmitterOriginBuffer";
+
+    frame.originBuffer = m_device->createBuffer(originBufferDesc);
+    frame.originMapped = frame.originBuffer ? frame.originBuffer->getMappedData() : nullptr;
+}
+
+void ParticleSystem::releaseRetiredBuffers() {
+    // uploadToGPU() runs once per frame after that slot's in-flight fence was
+    // waited, so once every slot has been cycled the retired buffer is idle.
+    m_retiredBuffers.erase(
+        std::remove_if(m_retiredBuffers.begin(), m_retiredBuffers.end(),
+            [this](const RetiredBuffer& retired) {
+                return retired.retiredAtUpload + MAX_FRAMES_IN_FLIGHT <= m_uploadCounter;
+            }),
+        m_retiredBuffers.end()
+    );
 }
 
 } // namespace effects
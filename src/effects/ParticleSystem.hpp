@@ -1,8 +1,15 @@
 #pragma once
 
 #include "Particle.hpp"
+#include "ParticleSorter.hpp"
+#include "src/scene/AABB.hpp"
+#include "src/scene/Frustum.hpp"
+#include "src/utils/SlotMap.hpp"
 #include <rhi/RHI.hpp>
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <vector>
 #include <memory>
 #include <random>
@@ -13,13 +20,21 @@ namespace effects {
 /**
  * @brief Single particle emitter
  *
- * Manages a pool of particles with a specific configuration.
+ * Manages a pool of particles with a specific configuration. Particles are
+ * stored as structure-of-arrays streams with live particles packed densely in
+ * [0, activeCount): spawning appends, dying swap-removes with the last live
+ * particle. update() integrates the live range with simd::Float.
  */
 class ParticleEmitter {
 public:
     ParticleEmitter(uint32_t maxParticles, const EmitterConfig& config);
     ~ParticleEmitter() = default;
 
+    /**
+     * @brief Reinitialize a pooled emitter, reusing its stream storage and RNG
+     */
+    void reset(uint32_t maxParticles, const EmitterConfig& config);
+
     // Non-copyable
     ParticleEmitter(const ParticleEmitter&) = delete;
     ParticleEmitter& operator=(const ParticleEmitter&) = delete;
@@ -47,9 +62,25 @@ public:
     void burst(uint32_t count);
 
     /**
-     * @brief Get particle data for rendering
+     * @brief Gather a live particle into the GPU layout
+     * @param index Index in [0, getActiveCount())
+     */
+    Particle getParticle(uint32_t index) const;
+
+    /**
+     * @brief Pack a live particle into the render format
+     * @param index Index in [0, getActiveCount())
+     * @param emitterIndex Slot of this emitter in the frame's origin buffer
+     * @param out Destination (typically mapped GPU memory)
      */
-    const std::vector<Particle>& getParticles() const { return m_particles; }
+    void writeVertex(uint32_t index, uint16_t emitterIndex, ParticleVertex& out) const;
+
+    /**
+     * @brief World position of a live particle
+     */
+    glm::vec3 getParticlePosition(uint32_t index) const {
+        return glm::vec3(stream(PositionX)[index], stream(PositionY)[index], stream(PositionZ)[index]);
+    }
 
     /**
      * @brief Get number of active (alive) particles
@@ -84,7 +115,73 @@ public:
      */
     bool hasActiveParticles() const { return m_activeCount > 0; }
 
+    /**
+     * @brief Conservative world bounds of live particles and the spawn volume
+     *
+     * Recomputed by update(); padded by the largest particle half-size.
+     */
+    const scene::AABB& getBounds() const { return m_bounds; }
+
+    /**
+     * @brief Apply distance LOD
+     * @param emissionScale Multiplier on emission rate / burst count (0 = no spawning)
+     * @param sizeScale Multiplier on the size of newly spawned particles
+     */
+    void setLod(float emissionScale, float sizeScale) {
+        m_emissionScale = emissionScale;
+        m_sizeScale = sizeScale;
+    }
+    float getEmissionScale() const { return m_emissionScale; }
+
+    /**
+     * @brief Frustum visibility from the last ParticleSystem::update()
+     */
+    void setVisible(bool visible) { m_visible = visible; }
+    bool isVisible() const { return m_visible; }
+
+    /**
+     * @brief Accumulate time skipped by coarse (off-screen) simulation
+     */
+    void deferTime(float deltaTime) { m_deferredTime += deltaTime; }
+
+    /**
+     * @brief Take accumulated skipped time, to be folded into the next step
+     */
+    float consumeDeferredTime() {
+        float time = m_deferredTime;
+        m_deferredTime = 0.0f;
+        return time;
+    }
+
+    /**
+     * @brief Budget bookkeeping, assigned by ParticleSystem on admission
+     */
+    void setAdmission(ParticleEffectType effectType, float priority, float fillCost) {
+        m_effectType = effectType;
+        m_priority = priority;
+        m_fillCost = fillCost;
+    }
+    ParticleEffectType getEffectType() const { return m_effectType; }
+    float getPriority() const { return m_priority; }
+    void setPriority(float priority) { m_priority = priority; }
+    float getFillCost() const { return m_fillCost; }
+
 private:
+    // SoA particle streams, each padded to simd::padCount(maxParticles)
+    enum Stream : uint32_t {
+        PositionX, PositionY, PositionZ,
+        VelocityX, VelocityY, VelocityZ,
+        Lifetime, Age,
+        ColorR, ColorG, ColorB, ColorA,
+        SizeX, SizeY,
+        Rotation, RotationSpeed,
+        StreamCount
+    };
+    float* stream(Stream s) { return m_streams.data() + static_cast<size_t>(s) * m_streamStride; }
+    const float* stream(Stream s) const { return m_streams.data() + static_cast<size_t>(s) * m_streamStride; }
+
+    void removeParticle(uint32_t index);
+    void updateBounds(const glm::vec3& particleMin, const glm::vec3& particleMax, float maxHalfSize);
     void spawnParticle();
     glm::vec3 randomPositionInShape();
     glm::vec3 randomVelocity();
@@ -93,21 +190,65 @@ private:
     glm::vec3 randomInCone(const glm::vec3& direction, float angle);
 
     EmitterConfig m_config;
-    std::vector<Particle> m_particles;
+    std::vector<float> m_streams;
+    uint32_t m_streamStride;
     uint32_t m_maxParticles;
     uint32_t m_activeCount = 0;
     float m_emissionAccumulator = 0.0f;
     bool m_enabled = true;
 
+    // Culling / LOD state
+    scene::AABB m_bounds;
+    float m_emissionScale = 1.0f;
+    float m_sizeScale = 1.0f;
+    float m_deferredTime = 0.0f;
+    bool m_visible = true;
+
+    // Budget admission state
+    ParticleEffectType m_effectType = ParticleEffectType::Custom;
+    float m_priority = 1.0f;
+    float m_fillCost = 0.0f;
+
     std::mt19937 m_rng;
     std::uniform_real_distribution<float> m_dist{0.0f, 1.0f};
 };
 
+/**
+ * @brief Stable reference to an emitter owned by a ParticleSystem
+ *
+ * Generational: once the emitter is removed (explicitly or after it finished)
+ * the handle resolves to nullptr, even if the slot is reused.
+ */
+using EmitterHandle = SlotHandle<ParticleEmitter>;
+
 /**
  * @brief GPU-accelerated particle system
  *
  * Manages multiple emitters and handles GPU buffer management.
  * Supports both CPU and GPU simulation modes.
+ *
+ * Particle vertex buffers are kept in a per-frame-in-flight ring so the CPU
+ * never writes a buffer the GPU may still be reading. Buffers stay persistently
+ * mapped and live particles are packed straight into mapped memory as
+ * ParticleVertex, next to a per-frame buffer of emitter origins (vec4 each).
+ *
+ * Each upload writes alpha-blended particles first, sorted back-to-front by
+ * view depth, followed by additive particles in emitter order.
+ *
+ * When a camera is set, emitters are culled against the view frustum using
+ * their bounds: off-screen emitters are simulated every few frames with the
+ * accumulated time and are not uploaded. Emission rate falls off with
+ * distance (particles grow to compensate) and stops past maxEmitDistance.
+ *
+ * Emitters are addressed by generational EmitterHandles. Finished emitters
+ * are recycled through a pool, and emitters update in parallel on the shared
+ * ThreadPool (each owns its particles and RNG).
+ *
+ * A global budget bounds reserved particle capacity, emitter count and an
+ * estimate of screen fill. spawnEffect() admits effects by priority: under
+ * pressure a new effect merges into a nearby one of the same type; if it
+ * still does not fit it evicts lower-priority effects, or is shrunk to the
+ * remaining budget, or is dropped.
  */
 class ParticleSystem {
 public:
@@ -122,24 +263,47 @@ public:
      * @brief Create a new emitter
      * @param maxParticles Maximum particles for this emitter
      * @param config Emitter configuration
-     * @return Emitter ID for future reference
+     * @return Handle for future reference
      */
-    uint32_t createEmitter(uint32_t maxParticles, const EmitterConfig& config);
+    EmitterHandle createEmitter(uint32_t maxParticles, const EmitterConfig& config);
 
     /**
      * @brief Create emitter from effect type
      */
-    uint32_t createEmitter(uint32_t maxParticles, ParticleEffectType effectType);
+    EmitterHandle createEmitter(uint32_t maxParticles, ParticleEffectType effectType);
 
     /**
-     * @brief Remove an emitter
+     * @brief Remove an emitter (no-op for stale handles)
      */
-    void removeEmitter(uint32_t emitterId);
+    void removeEmitter(EmitterHandle handle);
 
     /**
-     * @brief Get emitter by ID
+     * @brief Get emitter by handle
+     * @return nullptr if the emitter no longer exists
      */
-    ParticleEmitter* getEmitter(uint32_t emitterId);
+    ParticleEmitter* getEmitter(EmitterHandle handle);
+
+    /**
+     * @brief Culling and distance LOD parameters
+     */
+    struct CullingSettings {
+        bool enabled = true;
+        float fullDetailDistance = 150.0f;     // Full emission rate and base size inside this range
+        float maxEmitDistance = 800.0f;        // No new particles beyond this range
+        float minEmissionScale = 0.2f;         // Emission multiplier just inside maxEmitDistance
+        float maxSizeScale = 2.5f;             // Upper bound on the compensating size multiplier
+        uint32_t offscreenUpdateInterval = 4;  // Off-screen emitters simulate every Nth frame
+    };
+    void setCullingSettings(const CullingSettings& settings) { m_cullingSettings = settings; }
+    const CullingSettings& getCullingSettings() const { return m_cullingSettings; }
+
+    /**
+     * @brief Set camera used for emitter culling and LOD (call before update)
+     * @param view View matrix
+     * @param projection Projection matrix
+     * @param position Camera world position
+     */
+    void setCamera(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& position);
 
     /**
      * @brief Update all emitters
@@ -148,9 +312,63 @@ public:
     void update(float deltaTime);
 
     /**
-     * @brief Upload particle data to GPU
+     * @brief Emitter culling statistics from the last update
      */
-    void uploadToGPU();
+    struct CullingStats {
+        uint32_t visibleEmitters = 0;
+        uint32_t culledEmitters = 0;    // Outside the frustum (coarse simulation, not uploaded)
+        uint32_t distantEmitters = 0;   // Beyond maxEmitDistance (no spawning)
+    };
+    const CullingStats& getCullingStats() const { return m_cullingStats; }
+
+    /**
+     * @brief Global limits applied by spawnEffect() admission control
+     *
+     * Fill is estimated in screens of overdraw: steady-state particle count
+     * times projected particle area, relative to the viewport (needs a camera).
+     */
+    struct BudgetSettings {
+        bool enabled = true;
+        uint32_t maxParticles = 60000;      // Reserved capacity across all emitters
+        uint32_t maxEmitters = 256;
+        float maxFillScreens = 8.0f;
+        float mergeRadius = 25.0f;          // Same-type effects closer than this merge under pressure
+        float mergePressure = 0.5f;         // Merge once any budget is this full
+        float minShrinkFraction = 0.25f;    // Drop instead of shrinking below this fraction
+    };
+    void setBudgetSettings(const BudgetSettings& settings) { m_budgetSettings = settings; }
+    const BudgetSettings& getBudgetSettings() const { return m_budgetSettings; }
+
+    /**
+     * @brief Current budget usage and cumulative admission outcomes
+     */
+    struct BudgetStats {
+        uint32_t reservedParticles = 0;
+        uint32_t emitters = 0;
+        float fillScreens = 0.0f;
+        uint32_t admitted = 0;
+        uint32_t merged = 0;
+        uint32_t shrunk = 0;
+        uint32_t dropped = 0;
+        uint32_t evicted = 0;
+    };
+    const BudgetStats& getBudgetStats() const { return m_budgetStats; }
+
+    /**
+     * @brief Admission priority for a market event
+     * @param priceChangePercent Price change that triggered the effect
+     * @return Priority in [0, 1]; a 10% move or larger is maximal
+     */
+    static float priorityFromPriceChange(float priceChangePercent) {
+        return std::min(std::abs(priceChangePercent) / 10.0f, 1.0f);
+    }
+
+    /**
+     * @brief Upload live particles into this frame's vertex buffer
+     * @param frameIndex Frame-in-flight slot (its fence must already be waited)
+     * @param view View matrix used to depth-sort alpha-blended particles
+     */
+    void uploadToGPU(uint32_t frameIndex, const glm::mat4& view);
 
     /**
      * @brief Get total active particle count across all emitters
@@ -164,22 +382,61 @@ public:
 
     /**
      * @brief Get GPU particle buffer for rendering
+     * @param frameIndex Frame-in-flight slot passed to uploadToGPU()
      */
-    rhi::RHIBuffer* getParticleBuffer() const { return m_particleBuffer.get(); }
+    rhi::RHIBuffer* getParticleBuffer(uint32_t frameIndex) const {
+        return m_frames[frameIndex % MAX_FRAMES_IN_FLIGHT].particleBuffer.get();
+    }
+
+    /**
+     * @brief Get emitter origin buffer (vec4 per drawn emitter, read by the vertex shader)
+     */
+    rhi::RHIBuffer* getEmitterOriginBuffer(uint32_t frameIndex) const {
+        return m_frames[frameIndex % MAX_FRAMES_IN_FLIGHT].originBuffer.get();
+    }
 
     /**
      * @brief Get particle count buffer (for indirect rendering)
      */
-    rhi::RHIBuffer* getCountBuffer() const { return m_countBuffer.get(); }
+    rhi::RHIBuffer* getCountBuffer(uint32_t frameIndex) const {
+        return m_frames[frameIndex % MAX_FRAMES_IN_FLIGHT].countBuffer.get();
+    }
+
+    /**
+     * @brief Get number of particles written by the last upload for a frame slot
+     */
+    uint32_t getUploadedCount(uint32_t frameIndex) const {
+        return m_frames[frameIndex % MAX_FRAMES_IN_FLIGHT].uploadedCount;
+    }
+
+    /**
+     * @brief Get number of sorted alpha-blended particles at the start of the buffer
+     *
+     * Additive particles follow them: [alphaCount, uploadedCount).
+     */
+    uint32_t getAlphaCount(uint32_t frameIndex) const {
+        return m_frames[frameIndex % MAX_FRAMES_IN_FLIGHT].alphaCount;
+    }
+
+    /**
+     * @brief Depth sort statistics from the last upload
+     */
+    struct SortStats {
+        uint32_t sortedCount = 0;
+        float cpuMs = 0.0f;
+    };
+    const SortStats& getSortStats() const { return m_sortStats; }
 
     /**
      * @brief Spawn effect at position
      * @param effectType Type of effect
      * @param position World position
      * @param duration Duration in seconds (0 = infinite)
-     * @return Emitter ID
+     * @param priority Admission priority in [0, 1] (see priorityFromPriceChange)
+     * @return Emitter handle; the merged-into emitter when merged, invalid when dropped
      */
-    uint32_t spawnEffect(ParticleEffectType effectType, const glm::vec3& position, float duration = 0.0f);
+    EmitterHandle spawnEffect(ParticleEffectType effectType, const glm::vec3& position,
+                              float duration = 0.0f, float priority = 1.0f);
 
     /**
      * @brief Set simulation mode
@@ -192,30 +449,88 @@ public:
     SimulationMode getSimulationMode() const { return m_simulationMode; }
 
 private:
-    void createGPUBuffers(uint32_t maxParticles);
-    void collectParticlesForGPU();
+    // Per-frame GPU resources (one set per frame in flight)
+    static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 2;
+    struct FrameResources {
+        std::unique_ptr<rhi::RHIBuffer> particleBuffer;
+        std::unique_ptr<rhi::RHIBuffer> countBuffer;
+        std::unique_ptr<rhi::RHIBuffer> originBuffer;
+        void* particleMapped = nullptr;   // Persistent mapping (nullptr if backend can't keep it mapped)
+        void* countMapped = nullptr;
+        void* originMapped = nullptr;
+        uint32_t capacity = 0;            // Capacity in particles
+        uint32_t originCapacity = 0;      // Capacity in emitter origins
+        uint32_t uploadedCount = 0;       // Particles written by the last upload
+        uint32_t alphaCount = 0;          // Leading sorted alpha-blended particles
+    };
+
+    // Particle queued for the depth sort
+    struct SortRef {
+        uint32_t emitterIndex;  // Into m_uploadEmitters
+        uint32_t index;
+    };
+
+    // Buffer replaced on growth, destroyed once the GPU can no longer reference it
+    struct RetiredBuffer {
+        std::unique_ptr<rhi::RHIBuffer> buffer;
+        uint64_t retiredAtUpload;
+    };
+
+    void applyLod(ParticleEmitter& emitter) const;
+    void stepEmitter(ParticleEmitter& emitter, size_t denseIndex, float deltaTime) const;
+    void recycleEmitter(EmitterHandle handle);
+    float estimateFillCost(const EmitterConfig& config, uint32_t maxParticles) const;
+    EmitterHandle findMergeTarget(ParticleEffectType effectType, const glm::vec3& position) const;
+    float budgetPressure() const;
+    bool evictForBudget(uint32_t particles, float fillCost, float priority);
+    bool fitsBudget(uint32_t particles, float fillCost) const;
+    void createGPUBuffers(FrameResources& frame, uint32_t maxParticles);
+    void createOriginBuffer(FrameResources& frame, uint32_t maxEmitters);
+    void releaseRetiredBuffers();
 
     rhi::RHIDevice* m_device;
     rhi::RHIQueue* m_queue;
 
     // Emitters
-    std::vector<std::unique_ptr<ParticleEmitter>> m_emitters;
-    uint32_t m_nextEmitterId = 0;
-
-    // GPU buffers
-    std::unique_ptr<rhi::RHIBuffer> m_particleBuffer;
-    std::unique_ptr<rhi::RHIBuffer> m_countBuffer;
-    uint32_t m_gpuBufferCapacity = 0;
-
-    // Collected particles for GPU upload
-    std::vector<Particle> m_collectedParticles;
+    SlotMap<std::unique_ptr<ParticleEmitter>, ParticleEmitter> m_emitters;
+    std::vector<std::unique_ptr<ParticleEmitter>> m_emitterPool;  // Finished emitters kept for reuse
+    static constexpr size_t MAX_POOLED_EMITTERS = 64;
+    static constexpr size_t PARALLEL_UPDATE_MIN_EMITTERS = 4;
+
+    // GPU buffers (ring indexed by frame-in-flight slot)
+    std::array<FrameResources, MAX_FRAMES_IN_FLIGHT> m_frames;
+    std::vector<RetiredBuffer> m_retiredBuffers;
+    uint64_t m_uploadCounter = 0;
+
+    // Emitters drawn by the current upload, in origin buffer order
+    std::vector<const ParticleEmitter*> m_uploadEmitters;
+    static constexpr uint32_t MAX_UPLOAD_EMITTERS = 65535;  // ParticleVertex::emitterIndex is 16-bit
+
+    // Emitter culling / LOD
+    CullingSettings m_cullingSettings;
+    CullingStats m_cullingStats;
+    scene::Frustum m_frustum;
+    glm::vec3 m_cameraPosition{0.0f};
+    bool m_hasCamera = false;
+    float m_projectedAreaScale = 0.0f;  // proj[0][0] * proj[1][1], world area at unit depth -> NDC area
+    uint32_t m_frameCounter = 0;
+
+    // Effect budget (usage totals kept current by createEmitter / recycleEmitter)
+    BudgetSettings m_budgetSettings;
+    BudgetStats m_budgetStats;
+    std::vector<uint32_t> m_evictionCandidates;  // Dense indices, scratch for evictForBudget()
+
+    // Back-to-front sort for alpha-blended emitters
+    ParticleSorter m_sorter;
+    std::vector<SortRef> m_sortRefs;
+    SortStats m_sortStats;
 
     // Simulation mode
     SimulationMode m_simulationMode = SimulationMode::CPU;
 
     // Timed effects (auto-remove)
     struct TimedEffect {
-        uint32_t emitterId;
+        EmitterHandle emitter;
         float remainingTime;
     };
     std::vector<TimedEffect> m_timedEffects;
@@ -19,6 +19,10 @@ glm::mat4 BuildingEntity::getTransformMatrix() const {
 }
 
 glm::vec4 BuildingEntity::getColor() const {
+    return colorForPriceChange(priceChangePercent);
+}
+
+glm::vec4 BuildingEntity::colorForPriceChange(float priceChangePercent) {
     // Color based on price change percentage
     // Green for positive, red for negative, gray for neutral
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "src/game/sync/SymbolTable.hpp"
 #include <glm/glm.hpp>
 #include <string>
 #include <cstdint>
@@ -31,11 +32,15 @@ enum class ParticleEffectType {
  * - Store visual parameters (height, position, color)
  * - Track animation state
  * - Reference rendering resources (mesh, material)
+ *
+ * BuildingManager stores buildings column-wise in a BuildingStore; this
+ * struct is the by-value snapshot returned by its queries.
  */
 struct BuildingEntity {
     // ========== Identity ==========
     uint64_t entityId;               // Unique entity ID
     std::string ticker;              // Ticker symbol (e.g., "AAPL", "BTC-USD")
+    SymbolId symbol;                 // Interned ticker (key of the price pipeline)
     std::string companyName;         // Company/asset name (e.g., "Apple Inc.")
     std::string sectorId;            // Sector ID (e.g., "NASDAQ", "KOSDAQ", "CRYPTO")
 
@@ -84,6 +89,7 @@ struct BuildingEntity {
     BuildingEntity()
         : entityId(0)
         , ticker("")
+        , symbol(INVALID_SYMBOL)
         , companyName("")
         , sectorId("")
         , currentPrice(0.0f)
@@ -128,6 +134,13 @@ struct BuildingEntity {
      */
     glm::vec4 getColor() const;
 
+    /**
+     * @brief Color coding shared by getColor() and the column-wise upload path
+     * @param priceChangePercent Percentage change
+     * @return Color vector (r, g, b, a)
+     */
+    static glm::vec4 colorForPriceChange(float priceChangePercent);
+
     /**
      * @brief Check if animation is complete
      * @return True if animation finished
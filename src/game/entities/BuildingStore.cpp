@@ -0,0 +1,109 @@
+#include "BuildingStore.hpp"
+#include <utility>
+
+BuildingHandle BuildingStore::create(
+    BuildingRecord record,
+    SymbolId symbol,
+    const glm::vec3& position,
+    const glm::vec3& baseScale,
+    float initialPrice,
+    float initialHeight,
+    uint64_t timestamp
+) {
+    // SlotMap::emplace appends to its dense array, so the new building's
+    // dense index is the current column length
+    BuildingHandle handle = records.emplace(std::move(record));
+
+    hot.symbol.push_back(symbol);
+    hot.position.push_back(position);
+    hot.baseScale.push_back(baseScale);
+
+    hot.currentPrice.push_back(initialPrice);
+    hot.previousPrice.push_back(initialPrice);
+    hot.priceChangePercent.push_back(0.0f);
+    hot.tickVolume.push_back(0.0f);
+    hot.lastUpdateTimestamp.push_back(timestamp);
+    hot.lastTickTime.push_back(0);
+
+    hot.currentHeight.push_back(initialHeight);
+    hot.targetHeight.push_back(initialHeight);
+
+    hot.effectType.push_back(ParticleEffectType::None);
+    hot.effectIntensity.push_back(0.0f);
+    hot.hasParticleEffect.push_back(0);
+
+    return handle;
+}
+
+uint32_t BuildingStore::appendDefault(uint32_t count) {
+    uint32_t first = static_cast<uint32_t>(records.size());
+    for (uint32_t i = 0; i < count; ++i) {
+        records.emplace();
+    }
+
+    size_t newSize = records.size();
+    forEachColumn([newSize](auto& column) { column.resize(newSize); });
+    return first;
+}
+
+bool BuildingStore::destroy(BuildingHandle handle) {
+    uint32_t index = indexOf(handle);
+    if (index == INVALID_INDEX) {
+        return false;
+    }
+
+    // Mirror SlotMap::erase: the last building moves into the hole
+    records.erase(handle);
+    forEachColumn([index](auto& column) {
+        column[index] = std::move(column.back());
+        column.pop_back();
+    });
+    return true;
+}
+
+void BuildingStore::clear() {
+    records.clear();
+    forEachColumn([](auto& column) { column.clear(); });
+}
+
+void BuildingStore::reserve(size_t capacity) {
+    records.reserve(capacity);
+    forEachColumn([capacity](auto& column) { column.reserve(capacity); });
+}
+
+BuildingEntity BuildingStore::gather(uint32_t index, Mesh* mesh) const {
+    const BuildingRecord& cold = records[index];
+
+    BuildingEntity building;
+    building.entityId = records.handleAt(index).toBits();
+    building.ticker = cold.ticker;
+    building.symbol = hot.symbol[index];
+    building.companyName = cold.companyName;
+    building.sectorId = cold.sectorId;
+
+    building.currentPrice = hot.currentPrice[index];
+    building.previousPrice = hot.previousPrice[index];
+    building.priceChangePercent = hot.priceChangePercent[index];
+    building.marketCap = cold.marketCap;
+    building.volume24h = cold.volume24h;
+
+    building.currentHeight = hot.currentHeight[index];
+    building.targetHeight = hot.targetHeight[index];
+    building.baseScale = hot.baseScale[index];
+
+    building.position = hot.position[index];
+    building.rotation = cold.rotation;
+
+    // Animation state lives in BuildingManager's AnimationPool; at rest here
+    building.isAnimating = false;
+    building.animationProgress = 1.0f;
+    building.animationStartHeight = hot.currentHeight[index];
+
+    building.hasParticleEffect = hot.hasParticleEffect[index] != 0;
+    building.effectType = hot.effectType[index];
+    building.effectIntensity = hot.effectIntensity[index];
+
+    building.mesh = mesh;
+    building.lastUpdateTimestamp = hot.lastUpdateTimestamp[index];
+    return building;
+}
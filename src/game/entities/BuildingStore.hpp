@@ -0,0 +1,185 @@
+#pragma once
+
+#include "BuildingEntity.hpp"
+#include "src/utils/SlotMap.hpp"
+#include <glm/glm.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Generational handle to a building in a BuildingStore
+ *
+ * Entity IDs handed out by BuildingManager are these handles packed with
+ * toBits(); a destroyed building's ID never resolves to a later building.
+ */
+using BuildingHandle = SlotHandle<BuildingEntity>;
+
+/**
+ * @brief Cold per-building data (identity, display-only fields)
+ *
+ * Touched on creation, queries and UI only; never by per-update or
+ * per-frame loops.
+ */
+struct BuildingRecord {
+    std::string ticker;              // Ticker symbol (e.g., "AAPL", "BTC-USD")
+    std::string companyName;         // Company/asset name (e.g., "Apple Inc.")
+    std::string sectorId;            // Sector ID (e.g., "NASDAQ", "KOSDAQ", "CRYPTO")
+    glm::vec4 rotation{1.0f, 0.0f, 0.0f, 0.0f};  // Quaternion (w, x, y, z)
+    float marketCap = 0.0f;          // Market capitalization (future use)
+    float volume24h = 0.0f;          // 24-hour trading volume (future use)
+};
+
+/**
+ * @brief Hot per-building columns, one element per live building
+ *
+ * All columns share the store's dense index. Callers may read and write
+ * elements in place but must not resize columns; BuildingStore owns the
+ * layout.
+ */
+struct BuildingColumns {
+    // ========== Identity / Placement ==========
+    std::vector<SymbolId> symbol;
+    std::vector<glm::vec3> position;
+    std::vector<glm::vec3> baseScale;
+
+    // ========== Market Data ==========
+    std::vector<float> currentPrice;
+    std::vector<float> previousPrice;
+    std::vector<float> priceChangePercent;
+    std::vector<float> tickVolume;            // Volume of the latest tick (0 = none reported)
+    std::vector<uint64_t> lastUpdateTimestamp;
+    std::vector<uint64_t> lastTickTime;       // latency::now() when the latest tick was applied (0 = none)
+
+    // ========== Height ==========
+    std::vector<float> currentHeight;
+    std::vector<float> targetHeight;
+
+    // ========== Visual Effects ==========
+    std::vector<ParticleEffectType> effectType;
+    std::vector<float> effectIntensity;
+    std::vector<uint8_t> hasParticleEffect;
+};
+
+/**
+ * @brief Structure-of-arrays building storage with generational handles
+ *
+ * Buildings live densely in [0, size()): hot fields in BuildingColumns,
+ * cold fields in BuildingRecord. Creation appends; destruction swap-removes
+ * the last building into the hole, so dense indices are not stable across
+ * destroy() but handles are. Per-frame loops iterate the columns linearly.
+ */
+class BuildingStore {
+public:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    /**
+     * @brief Add a building
+     * @param record Cold data (moved in)
+     * @param symbol Interned ticker
+     * @param position World position
+     * @param baseScale Base scale (width, -, depth)
+     * @param initialPrice Initial price (also the previous price)
+     * @param initialHeight Initial height (also the target height)
+     * @param timestamp Creation time (milliseconds)
+     * @return Handle of the new building
+     */
+    BuildingHandle create(
+        BuildingRecord record,
+        SymbolId symbol,
+        const glm::vec3& position,
+        const glm::vec3& baseScale,
+        float initialPrice,
+        float initialHeight,
+        uint64_t timestamp
+    );
+
+    /**
+     * @brief Append buildings with default-constructed records and columns
+     * @param count Number of buildings
+     * @return Dense index of the first new building
+     *
+     * For bulk spawning: the caller fills [first, first + count) of every
+     * column and record afterwards, possibly from several threads (each
+     * element is touched by one thread only).
+     */
+    uint32_t appendDefault(uint32_t count);
+
+    /**
+     * @brief Remove a building (swap-remove)
+     * @return False if the handle is stale
+     */
+    bool destroy(BuildingHandle handle);
+
+    /**
+     * @brief Remove every building (outstanding handles become stale)
+     */
+    void clear();
+
+    /**
+     * @brief Reserve capacity in every column
+     */
+    void reserve(size_t capacity);
+
+    bool contains(BuildingHandle handle) const { return records.contains(handle); }
+
+    /**
+     * @brief Dense index of a building
+     * @return INVALID_INDEX if the handle is stale
+     */
+    uint32_t indexOf(BuildingHandle handle) const {
+        return records.contains(handle) ? records.denseIndexOf(handle) : INVALID_INDEX;
+    }
+
+    /**
+     * @brief Handle of the building at a dense index
+     */
+    BuildingHandle handleAt(uint32_t index) const { return records.handleAt(index); }
+
+    size_t size() const { return records.size(); }
+    bool empty() const { return records.empty(); }
+
+    /**
+     * @brief Hot columns (dense, indexed by [0, size()))
+     */
+    BuildingColumns& columns() { return hot; }
+    const BuildingColumns& columns() const { return hot; }
+
+    /**
+     * @brief Cold data of the building at a dense index
+     */
+    BuildingRecord& record(uint32_t index) { return records[index]; }
+    const BuildingRecord& record(uint32_t index) const { return records[index]; }
+
+    /**
+     * @brief Assemble an array-of-structs snapshot of one building
+     * @param index Dense index
+     * @param mesh Shared mesh to reference
+     */
+    BuildingEntity gather(uint32_t index, Mesh* mesh) const;
+
+private:
+    /**
+     * @brief Apply fn to every hot column (keeps resize/swap logic in one place)
+     */
+    template<typename Fn>
+    void forEachColumn(Fn&& fn) {
+        fn(hot.symbol);
+        fn(hot.position);
+        fn(hot.baseScale);
+        fn(hot.currentPrice);
+        fn(hot.previousPrice);
+        fn(hot.priceChangePercent);
+        fn(hot.tickVolume);
+        fn(hot.lastUpdateTimestamp);
+        fn(hot.lastTickTime);
+        fn(hot.currentHeight);
+        fn(hot.targetHeight);
+        fn(hot.effectType);
+        fn(hot.effectIntensity);
+        fn(hot.hasParticleEffect);
+    }
+
+    SlotMap<BuildingRecord, BuildingEntity> records;  // Dense order matches the columns
+    BuildingColumns hot;
+};
@@ -1,7 +1,10 @@
 #include "BuildingManager.hpp"
 #include "src/scene/Mesh.hpp"
+#include "src/game/world/WorldSnapshot.hpp"
 #include "src/utils/Vertex.hpp"
 #include "src/utils/Logger.hpp"
+#include "src/utils/Morton.hpp"
+#include "src/utils/ThreadPool.hpp"
 #include <glm/gtc/matrix_transform.hpp>
 #include <chrono>
 #include <algorithm>
@@ -9,11 +12,13 @@
 BuildingManager::BuildingManager(rhi::RHIDevice* device, rhi::RHIQueue* queue)
     : rhiDevice(device)
     , graphicsQueue(queue)
-    , entities()
-    , tickerToEntityId()
+    , store()
+    , symbolToEntityId()
+    , spatialIndex()
+    , sectorAggregates()
     , buildingMesh(nullptr)
-    , animatingEntities()
-    , nextEntityId(1)
+    , impostors()
+    , animations()
 {
 }
 
@@ -24,234 +29,527 @@ uint64_t BuildingManager::createBuilding(
     float initialPrice
 ) {
     // Check if ticker already exists
-    if (tickerToEntityId.find(ticker) != tickerToEntityId.end()) {
+    SymbolId symbol = SymbolTable::global().intern(ticker);
+    if (getEntityId(symbol) != 0) {
         LOG_WARN("BuildingManager") << "Ticker '" << ticker << "' already exists!";
         return 0; // Invalid ID
     }
 
-    // Generate new entity ID
-    uint64_t entityId = generateEntityId();
-
-    // Create new building entity
-    BuildingEntity building;
-    building.entityId = entityId;
-    building.ticker = ticker;
-    building.companyName = ticker; // Default to ticker (can be updated later)
-    building.sectorId = sectorId;
-    building.position = position;
-    building.currentPrice = initialPrice;
-    building.previousPrice = initialPrice;
-    building.priceChangePercent = 0.0f;
+    // Cold data
+    BuildingRecord record;
+    record.ticker = ticker;
+    record.companyName = ticker; // Default to ticker (can be updated later)
+    record.sectorId = sectorId;
 
     // Calculate initial height
-    building.currentHeight = calculateHeight(initialPrice, initialPrice);
-    building.targetHeight = building.currentHeight;
-    building.heightScale = 1.0f;
+    float initialHeight = calculateHeight(initialPrice, initialPrice);
 
     // Set default scale (5m x 5m base for better spacing)
-    building.baseScale = glm::vec3(5.0f, 1.0f, 5.0f);
-
-    // Initialize animation state
-    building.isAnimating = false;
-    building.animationProgress = 0.0f;
-    building.animationDuration = 1.5f; // 1.5 seconds default
-
-    // Initialize effect state
-    building.hasParticleEffect = false;
-    building.effectType = ParticleEffectType::None;
-
-    // Set mesh reference (shared mesh)
-    building.mesh = buildingMesh.get();
-    building.material = nullptr; // Material will be set later (color based on price change)
+    glm::vec3 baseScale(5.0f, 1.0f, 5.0f);
 
     // Timestamp
     auto now = std::chrono::system_clock::now();
-    building.lastUpdateTimestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
         now.time_since_epoch()
     ).count();
 
-    // Visibility
-    building.isVisible = true;
-    building.isDirty = true;
+    // Store entity; its ID is the packed generational handle (never 0)
+    BuildingHandle handle = store.create(std::move(record), symbol, position, baseScale,
+                                         initialPrice, initialHeight, timestamp);
+    uint64_t entityId = handle.toBits();
 
-    // Store entity
-    entities[entityId] = building;
-    tickerToEntityId[ticker] = entityId;
+    if (symbol >= symbolToEntityId.size()) {
+        symbolToEntityId.resize(static_cast<size_t>(symbol) + 1, 0);
+    }
+    symbolToEntityId[symbol] = entityId;
+    spatialIndex.insert(entityId, position);
+
+    uint32_t index = static_cast<uint32_t>(store.size() - 1);
+    uint32_t sector = sectorAggregates.findOrAddSector(sectorId);
+    sectorAggregates.add(sector, index, sectorSample(index), position);
+    impostors.add(index, sector, position, glm::vec2(baseScale.x, baseScale.z), initialHeight, 0.0f);
+
+    // Placed in Morton order at the next flush
+    instanceOrder.push_back(InstanceSlot{instanceKey(index), index});
+    ++spawnCount;
 
     // Mark instance buffer as dirty (needs update)
     objectBufferDirty = true;
 
     LOG_DEBUG("BuildingManager") << "Created building '" << ticker
               << "' at (" << position.x << ", " << position.y << ", " << position.z << ")"
-              << " with initial height " << building.currentHeight << "m";
+              << " with initial height " << initialHeight << "m";
 
     return entityId;
 }
 
+size_t BuildingManager::createBuildings(std::span<const BuildingSpawnDesc> descs, std::span<uint64_t> outEntityIds) {
+    auto start = std::chrono::steady_clock::now();
+    const bool writeIds = !outEntityIds.empty();
+
+    // Serial: resolve symbols and reject tickers that exist (or repeat in
+    // this batch, marked with PENDING_ENTITY until their IDs are known)
+    constexpr uint64_t PENDING_ENTITY = ~0ull;
+    std::vector<uint32_t> accepted;
+    std::vector<SymbolId> symbols;
+    accepted.reserve(descs.size());
+    symbols.reserve(descs.size());
+
+    for (uint32_t d = 0; d < descs.size(); ++d) {
+        const BuildingSpawnDesc& desc = descs[d];
+        SymbolId symbol = desc.symbol != INVALID_SYMBOL ? desc.symbol : SymbolTable::global().intern(desc.ticker);
+        if (writeIds) {
+            outEntityIds[d] = 0;
+        }
+        if (getEntityId(symbol) != 0) {
+            LOG_WARN("BuildingManager") << "Ticker '" << desc.ticker << "' already exists!";
+            continue;
+        }
+
+        if (symbol >= symbolToEntityId.size()) {
+            symbolToEntityId.resize(static_cast<size_t>(symbol) + 1, 0);
+        }
+        symbolToEntityId[symbol] = PENDING_ENTITY;
+        accepted.push_back(d);
+        symbols.push_back(symbol);
+    }
+
+    const uint32_t count = static_cast<uint32_t>(accepted.size());
+    if (count == 0) {
+        return 0;
+    }
+
+    // Reserve everything once, then append default entities to fill in place
+    store.reserve(store.size() + count);
+    instanceOrder.reserve(instanceOrder.size() + count);
+    const uint32_t first = store.appendDefault(count);
+    const size_t firstInstance = instanceOrder.size();
+    instanceOrder.resize(firstInstance + count);
+
+    const uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    const glm::vec3 baseScale(5.0f, 1.0f, 5.0f);
+
+    // Parallel: every chunk writes only its own elements
+    ThreadPool& pool = ThreadPool::shared();
+    constexpr uint32_t MIN_CHUNK_SIZE = 2048;
+    uint32_t chunkCount = std::min(pool.getConcurrency() * 4, (count + MIN_CHUNK_SIZE - 1) / MIN_CHUNK_SIZE);
+
+    pool.parallelFor(count, chunkCount, [&](uint32_t, uint32_t begin, uint32_t end) {
+        BuildingColumns& c = store.columns();
+        for (uint32_t k = begin; k < end; ++k) {
+            const BuildingSpawnDesc& desc = descs[accepted[k]];
+            uint32_t i = first + k;
+
+            BuildingRecord& record = store.record(i);
+            record.ticker = desc.ticker;
+            record.companyName = desc.ticker; // Default to ticker (can be updated later)
+            record.sectorId = desc.sectorId;
+
+            float initialHeight = calculateHeight(desc.initialPrice, desc.initialPrice);
+            c.symbol[i] = symbols[k];
+            c.position[i] = desc.position;
+            c.baseScale[i] = baseScale;
+            c.currentPrice[i] = desc.initialPrice;
+            c.previousPrice[i] = desc.initialPrice;
+            c.lastUpdateTimestamp[i] = timestamp;
+            c.currentHeight[i] = initialHeight;
+            c.targetHeight[i] = initialHeight;
+
+            instanceOrder[firstInstance + k] = InstanceSlot{instanceKey(i), i};
+        }
+    });
+
+    // Serial: hash-based indices and sector aggregates (descs usually come
+    // grouped by sector, so the last lookup is reused)
+    const std::string* lastSectorId = nullptr;
+    uint32_t sector = SectorAggregates::INVALID_SECTOR;
+    for (uint32_t k = 0; k < count; ++k) {
+        const BuildingSpawnDesc& desc = descs[accepted[k]];
+        uint32_t i = first + k;
+        uint64_t entityId = store.handleAt(i).toBits();
+        symbolToEntityId[symbols[k]] = entityId;
+        spatialIndex.insert(entityId, desc.position);
+
+        if (!lastSectorId || *lastSectorId != desc.sectorId) {
+            sector = sectorAggregates.findOrAddSector(desc.sectorId);
+            lastSectorId = &desc.sectorId;
+        }
+        sectorAggregates.add(sector, i, sectorSample(i), desc.position);
+        impostors.add(i, sector, desc.position, glm::vec2(baseScale.x, baseScale.z),
+                      store.columns().targetHeight[i], 0.0f);
+        if (writeIds) {
+            outEntityIds[accepted[k]] = entityId;
+        }
+    }
+
+    // One dirty mark: the next frame uploads the whole batch at once
+    spawnCount += count;
+    objectBufferDirty = true;
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG_INFO("BuildingManager") << "Spawned " << count << " buildings in " << seconds * 1000.0 << " ms ("
+                                << static_cast<uint64_t>(count / std::max(seconds, 1e-9)) << " buildings/s, "
+                                << chunkCount << " chunks)";
+    return count;
+}
+
+void BuildingManager::restoreBuildings(const worldsnapshot::BuildingView& view) {
+    auto start = std::chrono::steady_clock::now();
+    destroyAllBuildings();
+
+    const uint32_t count = view.count;
+    if (count == 0) {
+        return;
+    }
+
+    store.reserve(count);
+    store.appendDefault(count);
+    instanceOrder.resize(count);
+
+    // Parallel: columns are copied range by range, records filled from the string blob
+    ThreadPool& pool = ThreadPool::shared();
+    constexpr uint32_t MIN_CHUNK_SIZE = 4096;
+    uint32_t chunkCount = std::min(pool.getConcurrency() * 4, (count + MIN_CHUNK_SIZE - 1) / MIN_CHUNK_SIZE);
+
+    pool.parallelFor(count, chunkCount, [&](uint32_t, uint32_t begin, uint32_t end) {
+        BuildingColumns& c = store.columns();
+        auto copyRange = [begin, end](auto source, auto& column) {
+            std::copy(source.begin() + begin, source.begin() + end, column.begin() + begin);
+        };
+        copyRange(view.position, c.position);
+        copyRange(view.baseScale, c.baseScale);
+        copyRange(view.currentPrice, c.currentPrice);
+        copyRange(view.previousPrice, c.previousPrice);
+        copyRange(view.priceChangePercent, c.priceChangePercent);
+        copyRange(view.tickVolume, c.tickVolume);
+        copyRange(view.lastUpdateTimestamp, c.lastUpdateTimestamp);
+        copyRange(view.currentHeight, c.currentHeight);
+        copyRange(view.targetHeight, c.targetHeight);
+        copyRange(view.effectType, c.effectType);
+        copyRange(view.effectIntensity, c.effectIntensity);
+        copyRange(view.hasParticleEffect, c.hasParticleEffect);
+
+        for (uint32_t i = begin; i < end; ++i) {
+            const worldsnapshot::BuildingData& saved = view.records[i];
+            c.symbol[i] = view.symbolRemap[view.symbol[i]];
+
+            BuildingRecord& record = store.record(i);
+            record.ticker = view.string(view.symbolNames[view.symbol[i]]);
+            record.companyName = view.string(saved.companyName);
+            record.sectorId = view.string(saved.sectorId);
+            record.rotation = saved.rotation;
+            record.marketCap = saved.marketCap;
+            record.volume24h = saved.volume24h;
+
+            instanceOrder[i] = InstanceSlot{instanceKey(i), i};
+        }
+    });
+
+    // Serial: hash-based indices and per-sector state (buildings are saved
+    // in store order, which is mostly grouped by sector)
+    const BuildingColumns& c = store.columns();
+    const std::string* lastSectorId = nullptr;
+    uint32_t sector = SectorAggregates::INVALID_SECTOR;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint64_t entityId = store.handleAt(i).toBits();
+        SymbolId symbol = c.symbol[i];
+        if (symbol >= symbolToEntityId.size()) {
+            symbolToEntityId.resize(static_cast<size_t>(symbol) + 1, 0);
+        }
+        symbolToEntityId[symbol] = entityId;
+        spatialIndex.insert(entityId, c.position[i]);
+
+        const std::string& sectorId = store.record(i).sectorId;
+        if (!lastSectorId || *lastSectorId != sectorId) {
+            sector = sectorAggregates.findOrAddSector(sectorId);
+            lastSectorId = &sectorId;
+        }
+        sectorAggregates.add(sector, i, sectorSample(i), c.position[i]);
+        impostors.add(i, sector, c.position[i], glm::vec2(c.baseScale[i].x, c.baseScale[i].z),
+                      c.targetHeight[i], c.priceChangePercent[i]);
+    }
+
+    for (const worldsnapshot::AnimationData& saved : view.animations) {
+        animations.resume(saved.owner, AnimationPool::State{saved.start, saved.target, saved.progress,
+                                                            saved.duration, static_cast<EasingCurve>(saved.curve)});
+    }
+
+    spawnCount += count;
+    objectBufferDirty = true;
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG_INFO("BuildingManager") << "Restored " << count << " buildings (" << view.animations.size()
+                                << " animating) in " << seconds * 1000.0 << " ms (" << chunkCount << " chunks)";
+}
+
 bool BuildingManager::destroyBuilding(uint64_t entityId) {
-    auto it = entities.find(entityId);
-    if (it == entities.end()) {
+    uint32_t index = findIndex(entityId);
+    if (index == BuildingStore::INVALID_INDEX) {
         return false;
     }
 
-    // Remove from ticker map
-    std::string ticker = it->second.ticker;
-    tickerToEntityId.erase(ticker);
-
-    // Remove from animating list if present
-    auto animIt = std::find(animatingEntities.begin(), animatingEntities.end(), entityId);
-    if (animIt != animatingEntities.end()) {
-        animatingEntities.erase(animIt);
+    // Remove from symbol map and spatial index
+    symbolToEntityId[store.columns().symbol[index]] = 0;
+    spatialIndex.remove(entityId, store.columns().position[index]);
+    sectorAggregates.remove(index, sectorSample(index));
+    impostors.remove(index);
+
+    // Stop its animation and tombstone its object buffer slot (compacted at
+    // the next flush, so delisting many buildings costs one pass, not one each)
+    animations.remove(index);
+    if (sortedInstanceCount != instanceOrder.size()) {
+        flushInstanceOrder();
+    }
+    findInstanceSlot(index)->index = BuildingStore::INVALID_INDEX;
+    ++instanceTombstones;
+
+    // Remove entity; the store moves its last building into this index
+    store.destroy(BuildingHandle::fromBits(entityId));
+    uint32_t movedFrom = static_cast<uint32_t>(store.size());
+    if (index != movedFrom) {
+        animations.moveOwner(movedFrom, index);
+        sectorAggregates.moveOwner(movedFrom, index);
+        impostors.moveOwner(movedFrom, index);
+        findInstanceSlot(index)->index = index;
     }
 
-    // Remove entity
-    entities.erase(it);
+    // Remaining buildings shift slots in the object buffer
+    objectBufferDirty = true;
 
-    std::cout << "BuildingManager: Destroyed building ID " << entityId << std::endl;
+    LOG_DEBUG("BuildingManager") << "Destroyed building ID " << entityId;
     return true;
 }
 
 bool BuildingManager::destroyBuildingByTicker(const std::string& ticker) {
-    auto it = tickerToEntityId.find(ticker);
-    if (it == tickerToEntityId.end()) {
+    uint64_t entityId = getEntityId(SymbolTable::global().find(ticker));
+    if (entityId == 0) {
         return false;
     }
 
-    return destroyBuilding(it->second);
+    return destroyBuilding(entityId);
 }
 
 void BuildingManager::destroyAllBuildings() {
-    entities.clear();
-    tickerToEntityId.clear();
-    animatingEntities.clear();
-    std::cout << "BuildingManager: Destroyed all buildings" << std::endl;
+    store.clear();
+    symbolToEntityId.clear();
+    spatialIndex.clear();
+    sectorAggregates.clear();
+    impostors.clear();
+    animations.clear();
+    instanceOrder.clear();
+    sortedInstanceCount = 0;
+    instanceTombstones = 0;
+    uploadedTickTimes.clear();
+    objectBufferDirty = true;
+    LOG_INFO("BuildingManager") << "Destroyed all buildings";
 }
 
 bool BuildingManager::updatePrice(const std::string& ticker, float newPrice) {
-    // Find building by ticker
-    auto it = tickerToEntityId.find(ticker);
-    if (it == tickerToEntityId.end()) {
-        return false;
+    return updatePrice(SymbolTable::global().find(ticker), newPrice);
+}
+
+bool BuildingManager::updatePrice(SymbolId symbol, float newPrice) {
+    uint64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    return applyPrice(symbol, newPrice, 0.0f, nowMs) != BuildingStore::INVALID_INDEX;
+}
+
+uint32_t BuildingManager::applyPrice(SymbolId symbol, float newPrice, float volume, uint64_t timestamp) {
+    // Find building by symbol
+    uint64_t entityId = getEntityId(symbol);
+    if (entityId == 0) {
+        return BuildingStore::INVALID_INDEX;
     }
 
-    BuildingEntity& building = entities[it->second];
+    uint32_t i = findIndex(entityId);
+    if (i == BuildingStore::INVALID_INDEX) {
+        return BuildingStore::INVALID_INDEX;
+    }
+    BuildingColumns& c = store.columns();
+    SectorSample before = sectorSample(i);
 
     // Store previous price
-    building.previousPrice = building.currentPrice;
-    building.currentPrice = newPrice;
+    c.previousPrice[i] = c.currentPrice[i];
+    c.currentPrice[i] = newPrice;
 
     // Calculate price change percentage
-    if (building.previousPrice > 0.0f) {
-        building.priceChangePercent = ((newPrice - building.previousPrice) / building.previousPrice) * 100.0f;
+    if (c.previousPrice[i] > 0.0f) {
+        c.priceChangePercent[i] = ((newPrice - c.previousPrice[i]) / c.previousPrice[i]) * 100.0f;
     } else {
-        building.priceChangePercent = 0.0f;
+        c.priceChangePercent[i] = 0.0f;
     }
+    c.tickVolume[i] = volume;
+
+    // Sector stats follow in O(log n) (top gainer / loser heaps)
+    sectorAggregates.update(i, before, sectorSample(i));
 
     // Calculate new target height
-    float newHeight = calculateHeight(newPrice, building.previousPrice);
-    building.targetHeight = newHeight;
+    float newHeight = calculateHeight(newPrice, c.previousPrice[i]);
+    c.targetHeight[i] = newHeight;
+    impostors.update(i, newHeight, c.priceChangePercent[i]);
 
     // Start animation if height changed significantly (> 1 meter)
-    if (std::abs(newHeight - building.currentHeight) > 1.0f) {
-        building.isAnimating = true;
-        building.animationProgress = 0.0f;
-        building.animationStartHeight = building.currentHeight;
-
+    float heightDelta = std::abs(newHeight - c.currentHeight[i]);
+    if (heightDelta > 1.0f) {
         // Adjust animation duration based on height change
-        float heightDelta = std::abs(newHeight - building.currentHeight);
-        building.animationDuration = std::min(2.0f, 0.5f + heightDelta / 100.0f);
-
-        // Add to animating list if not already present
-        if (std::find(animatingEntities.begin(), animatingEntities.end(), building.entityId) == animatingEntities.end()) {
-            animatingEntities.push_back(building.entityId);
-        }
+        float duration = std::min(2.0f, 0.5f + heightDelta / 100.0f);
+        animations.start(i, c.currentHeight[i], newHeight, duration,
+                         determineEasingCurve(c.priceChangePercent[i]));
+    } else {
+        // Small moves keep a running animation going, towards the new height
+        animations.retarget(i, newHeight);
     }
 
     // Determine particle effect
-    building.effectType = determineParticleEffect(building.priceChangePercent);
-    building.hasParticleEffect = (building.effectType != ParticleEffectType::None);
-    building.effectIntensity = std::min(std::abs(building.priceChangePercent) / 10.0f, 1.0f);
+    c.effectType[i] = determineParticleEffect(c.priceChangePercent[i]);
+    c.hasParticleEffect[i] = (c.effectType[i] != ParticleEffectType::None);
+    c.effectIntensity[i] = std::min(std::abs(c.priceChangePercent[i]) / 10.0f, 1.0f);
 
     // Update timestamp
-    auto now = std::chrono::system_clock::now();
-    building.lastUpdateTimestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()
-    ).count();
+    c.lastUpdateTimestamp[i] = timestamp;
 
-    return true;
+    // Color (and possibly height) changed: the next upload must include it
+    objectBufferDirty = true;
+
+    return i;
 }
 
-void BuildingManager::batchUpdatePrices(const PriceUpdateBatch& updates) {
+void BuildingManager::batchUpdatePrices(const PriceUpdateBatch& updates, uint64_t applyTime) {
+    // Feeds that carry no timestamp are stamped with the time they were applied
+    uint64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+
+    BuildingColumns& c = store.columns();
     for (const auto& update : updates) {
-        updatePrice(update.ticker, update.price);
+        uint32_t i = applyPrice(update.symbol, update.price, update.volume, update.timestamp != 0 ? update.timestamp : nowMs);
+        if (i != BuildingStore::INVALID_INDEX) {
+            c.lastTickTime[i] = applyTime;
+        }
     }
 }
 
-BuildingEntity* BuildingManager::getBuilding(uint64_t entityId) {
-    auto it = entities.find(entityId);
-    if (it != entities.end()) {
-        return &it->second;
+size_t BuildingManager::applyPriceState(std::span<const SymbolId> symbols, std::span<const float> prices,
+                                        std::span<const float> previousPrices) {
+    BuildingColumns& c = store.columns();
+    size_t applied = 0;
+
+    for (size_t k = 0; k < symbols.size(); ++k) {
+        uint32_t i = findIndex(getEntityId(symbols[k]));
+        if (i == BuildingStore::INVALID_INDEX) {
+            continue;
+        }
+
+        SectorSample before = sectorSample(i);
+        c.previousPrice[i] = previousPrices[k];
+        c.currentPrice[i] = prices[k];
+        c.priceChangePercent[i] = previousPrices[k] > 0.0f
+            ? ((prices[k] - previousPrices[k]) / previousPrices[k]) * 100.0f
+            : 0.0f;
+        sectorAggregates.update(i, before, sectorSample(i));
+
+        float height = calculateHeight(prices[k], previousPrices[k]);
+        animations.remove(i);
+        c.currentHeight[i] = height;
+        c.targetHeight[i] = height;
+        impostors.update(i, height, c.priceChangePercent[i]);
+
+        c.effectType[i] = ParticleEffectType::None;
+        c.hasParticleEffect[i] = 0;
+        c.effectIntensity[i] = 0.0f;
+        ++applied;
     }
-    return nullptr;
+
+    objectBufferDirty = true;
+    return applied;
 }
 
-BuildingEntity* BuildingManager::getBuildingByTicker(const std::string& ticker) {
-    auto it = tickerToEntityId.find(ticker);
-    if (it != tickerToEntityId.end()) {
-        return &entities[it->second];
+std::optional<BuildingEntity> BuildingManager::getBuilding(uint64_t entityId) const {
+    uint32_t index = findIndex(entityId);
+    if (index == BuildingStore::INVALID_INDEX) {
+        return std::nullopt;
+    }
+
+    BuildingEntity building = store.gather(index, buildingMesh.get());
+    AnimationPool::State animation;
+    if (animations.getState(index, animation)) {
+        building.isAnimating = true;
+        building.animationProgress = animation.progress;
+        building.animationDuration = animation.duration;
+        building.animationStartHeight = animation.start;
     }
-    return nullptr;
+    return building;
 }
 
-std::vector<BuildingEntity*> BuildingManager::getBuildingsInSector(const std::string& sectorId) {
-    std::vector<BuildingEntity*> result;
-    for (auto& pair : entities) {
-        if (pair.second.sectorId == sectorId) {
-            result.push_back(&pair.second);
-        }
+std::optional<BuildingEntity> BuildingManager::getBuildingByTicker(const std::string& ticker) const {
+    return getBuildingBySymbol(SymbolTable::global().find(ticker));
+}
+
+std::optional<BuildingEntity> BuildingManager::getBuildingBySymbol(SymbolId symbol) const {
+    uint64_t entityId = getEntityId(symbol);
+    if (entityId == 0) {
+        return std::nullopt;
     }
-    return result;
+    return getBuilding(entityId);
 }
 
-std::vector<BuildingEntity*> BuildingManager::getAllBuildings() {
-    std::vector<BuildingEntity*> result;
-    result.reserve(entities.size());
-    for (auto& pair : entities) {
-        result.push_back(&pair.second);
+std::vector<uint64_t> BuildingManager::getBuildingsInSector(const std::string& sectorId) const {
+    std::vector<uint64_t> result;
+    for (uint32_t i = 0; i < store.size(); ++i) {
+        if (store.record(i).sectorId == sectorId) {
+            result.push_back(store.handleAt(i).toBits());
+        }
     }
     return result;
 }
 
-void BuildingManager::update(float deltaTime) {
-    // Mark dirty if we have any animating entities - shadows need updating
-    bool hasAnimatingEntities = !animatingEntities.empty();
+std::span<const rendering::SectorRenderData> BuildingManager::getSectorRenderData() {
+    if (sectorRenderVersion == sectorAggregates.getVersion()) {
+        return sectorRenderData;
+    }
 
-    // Update all animating entities
-    std::vector<uint64_t> toRemove;
+    sectorRenderData.resize(sectorAggregates.getSectorCount());
+    for (uint32_t s = 0; s < sectorRenderData.size(); ++s) {
+        SectorSummary summary = sectorAggregates.getSummary(s);
+        float count = static_cast<float>(summary.buildingCount);
+        float breadth = count > 0.0f
+            ? (static_cast<float>(summary.advancers) - static_cast<float>(summary.decliners)) / count
+            : 0.0f;
+        sectorRenderData[s].bounds = glm::vec4(summary.boundsMin.x, summary.boundsMin.y,
+                                               summary.boundsMax.x, summary.boundsMax.y);
+        sectorRenderData[s].stats = glm::vec4(summary.volumeWeightedChangePercent, breadth, count, 0.0f);
+    }
+    sectorRenderVersion = sectorAggregates.getVersion();
+    return sectorRenderData;
+}
 
-    for (uint64_t entityId : animatingEntities) {
-        auto it = entities.find(entityId);
-        if (it == entities.end()) {
-            toRemove.push_back(entityId);
-            continue;
-        }
+bool BuildingManager::setBuildingHeight(uint64_t entityId, float height) {
+    uint32_t index = findIndex(entityId);
+    if (index == BuildingStore::INVALID_INDEX) {
+        return false;
+    }
 
-        BuildingEntity& building = it->second;
-        updateAnimation(building, deltaTime);
+    BuildingColumns& c = store.columns();
+    animations.remove(index);
+    c.currentHeight[index] = height;
+    c.targetHeight[index] = height;
+    impostors.update(index, height, c.priceChangePercent[index]);
+    objectBufferDirty = true;
+    return true;
+}
 
-        // Remove from animating list if animation complete
-        if (building.isAnimationComplete()) {
-            toRemove.push_back(entityId);
-        }
-    }
+void BuildingManager::update(float deltaTime) {
+    // Mark dirty if we have any animating entities - shadows need updating
+    bool hasAnimatingEntities = !animations.empty();
 
-    // Remove completed animations
-    for (uint64_t entityId : toRemove) {
-        auto it = std::find(animatingEntities.begin(), animatingEntities.end(), entityId);
-        if (it != animatingEntities.end()) {
-            animatingEntities.erase(it);
-        }
-    }
+    // Advance all animations in one batch; finished ones leave the pool
+    BuildingColumns& c = store.columns();
+    animations.update(deltaTime, c.currentHeight, [&c](uint32_t index) {
+        c.hasParticleEffect[index] = 0; // Clear particle effect when animation ends
+    });
 
     // Mark instance buffer as dirty if ANY entities were animating this frame
     // This ensures shadow map gets updated with new building heights
@@ -260,13 +558,15 @@ void BuildingManager::update(float deltaTime) {
     }
 }
 
+void BuildingManager::updateLod(const glm::vec3& viewerPosition) {
+    if (impostors.updateLod(viewerPosition)) {
+        objectBufferDirty = true;
+        LOG_DEBUG("BuildingManager") << impostors.getImpostorSectorCount() << " sectors drawn as impostors";
+    }
+}
+
 void BuildingManager::setBuildingMesh(std::unique_ptr<Mesh> mesh) {
     buildingMesh = std::move(mesh);
-
-    // Update all entities to use new mesh
-    for (auto& pair : entities) {
-        pair.second.mesh = buildingMesh.get();
-    }
 }
 
 void BuildingManager::createDefaultMesh() {
@@ -336,42 +636,13 @@ float BuildingManager::calculateHeight(float price, float basePrice) {
     return HeightCalculator::calculateDefaultHeight(price, basePrice);
 }
 
-void BuildingManager::updateAnimation(BuildingEntity& entity, float deltaTime) {
-    if (!entity.isAnimating) {
-        return;
-    }
-
-    // Update animation progress
-    entity.animationProgress += deltaTime / entity.animationDuration;
-
-    if (entity.animationProgress >= 1.0f) {
-        // Animation complete
-        entity.animationProgress = 1.0f;
-        entity.currentHeight = entity.targetHeight;
-        entity.isAnimating = false;
-        entity.hasParticleEffect = false; // Clear particle effect when animation ends
+EasingCurve BuildingManager::determineEasingCurve(float priceChangePercent) {
+    if (priceChangePercent > 5.0f) {
+        return EasingCurve::Surge;      // Surge: elastic easing
+    } else if (priceChangePercent < -5.0f) {
+        return EasingCurve::Crash;      // Crash: accelerating easing
     } else {
-        // Interpolate height using easing function
-        float t = entity.animationProgress;
-
-        // Choose easing function based on price change
-        float easedT;
-        if (entity.priceChangePercent > 5.0f) {
-            // Surge: elastic easing
-            easedT = AnimationUtils::surgeEasing(t);
-        } else if (entity.priceChangePercent < -5.0f) {
-            // Crash: accelerating easing
-            easedT = AnimationUtils::crashEasing(t);
-        } else {
-            // Normal: smooth easing
-            easedT = AnimationUtils::defaultHeightEasing(t);
-        }
-
-        entity.currentHeight = AnimationUtils::lerp(
-            entity.animationStartHeight,
-            entity.targetHeight,
-            easedT
-        );
+        return EasingCurve::Default;    // Normal: smooth easing
     }
 }
 
@@ -389,19 +660,57 @@ ParticleEffectType BuildingManager::determineParticleEffect(float priceChangePer
     }
 }
 
-uint64_t BuildingManager::generateEntityId() {
-    return nextEntityId++;
-}
-
 // ============================================================================
 // GPU Object Buffer (Phase 2.1 SSBO)
 // ============================================================================
 
+uint64_t BuildingManager::instanceKey(uint32_t index) const {
+    const glm::vec3& p = store.columns().position[index];
+    uint32_t code = morton::encodeWorldXZ(p.x, p.z, MORTON_CELL_SIZE);
+    return (static_cast<uint64_t>(code) << 32) | store.handleAt(index).index;
+}
+
+void BuildingManager::flushInstanceOrder() {
+    if (instanceTombstones > 0) {
+        // Tombstones only ever sit in the sorted range; removal keeps it sorted
+        auto sortedEnd = instanceOrder.begin() + static_cast<std::ptrdiff_t>(sortedInstanceCount);
+        auto kept = std::remove_if(instanceOrder.begin(), sortedEnd, [](const InstanceSlot& slot) {
+            return slot.index == BuildingStore::INVALID_INDEX;
+        });
+        instanceOrder.erase(kept, sortedEnd);
+        sortedInstanceCount -= instanceTombstones;
+        instanceTombstones = 0;
+    }
+
+    if (sortedInstanceCount == instanceOrder.size()) {
+        return;
+    }
+
+    // Sort only the newly spawned tail, then merge it in: O(k log k + n)
+    auto byKey = [](const InstanceSlot& a, const InstanceSlot& b) { return a.key < b.key; };
+    auto tail = instanceOrder.begin() + static_cast<std::ptrdiff_t>(sortedInstanceCount);
+    std::sort(tail, instanceOrder.end(), byKey);
+    std::inplace_merge(instanceOrder.begin(), tail, instanceOrder.end(), byKey);
+    sortedInstanceCount = instanceOrder.size();
+}
+
+std::vector<BuildingManager::InstanceSlot>::iterator BuildingManager::findInstanceSlot(uint32_t index) {
+    // Keys are unique among live buildings; a tombstone's key can only come
+    // back (handle slot reused at the same spot) in the tail, after it
+    uint64_t key = instanceKey(index);
+    auto sortedEnd = instanceOrder.begin() + static_cast<std::ptrdiff_t>(sortedInstanceCount);
+    return std::lower_bound(instanceOrder.begin(), sortedEnd, key,
+                            [](const InstanceSlot& slot, uint64_t k) { return slot.key < k; });
+}
+
 void BuildingManager::updateObjectBuffer() {
     using rendering::ObjectData;
 
+    const BuildingColumns& c = store.columns();
+    const size_t buildingCount = store.size();
+
     std::vector<ObjectData> objectData;
-    objectData.reserve(entities.size() + 1);  // +1 for ground
+    objectData.resize(buildingCount + 1);  // +1 for ground (upper bound: impostor sectors shrink it)
 
     // Add ground plane first (large flat plane at y=0, scaled to fit all buildings)
     {
@@ -409,11 +718,11 @@ void BuildingManager::updateObjectBuffer() {
         glm::vec3 pos(0.0f, -0.05f, 0.0f);
         // Scale ground to cover building grid with margin
         float gridExtent = 300.0f;  // default
-        if (!entities.empty()) {
+        if (buildingCount > 0) {
             float maxDist = 0.0f;
-            for (const auto& [id, b] : entities) {
-                float d = std::max(std::abs(b.position.x), std::abs(b.position.z));
-                if (d > maxDist) maxDist = d;
+            for (size_t i = 0; i < buildingCount; ++i) {
+                const glm::vec3& p = c.position[i];
+                maxDist = std::max(maxDist, std::max(std::abs(p.x), std::abs(p.z)));
             }
             gridExtent = std::max(300.0f, (maxDist + 50.0f) * 2.0f);
         }
@@ -428,17 +737,42 @@ void BuildingManager::updateObjectBuffer() {
         // Material
         ground.colorAndMetallic = glm::vec4(0.55f, 0.58f, 0.52f, 0.0f);  // sRGB gray-green, non-metallic
         ground.roughnessAOPad = glm::vec4(0.9f, 1.0f, 0.0f, 0.0f);
-        objectData.push_back(ground);
+        objectData[0] = ground;
     }
 
-    // Add all buildings
-    for (const auto& [entityId, building] : entities) {
-        ObjectData obj{};
-        glm::vec3 pos = building.position;
-        glm::vec3 scale(building.baseScale.x, building.currentHeight, building.baseScale.z);
+    // Ticks applied since the previous upload become visible with this one
+    uint64_t newestTick = uploadedTickCutoff;
+
+    // Add all buildings in Morton order: cull threads and visibleIndices
+    // then walk spatially coherent runs instead of spawn order
+    flushInstanceOrder();
+    size_t objectCount = 1;
+    for (size_t slot = 0; slot < buildingCount; ++slot) {
+        uint32_t i = instanceOrder[slot].index;
+        if (c.lastTickTime[i] > uploadedTickCutoff) {
+            // Bounded in case nobody takes them (frames skipped while minimized)
+            if (uploadedTickTimes.size() < MAX_PENDING_TICK_TIMES) {
+                uploadedTickTimes.push_back(c.lastTickTime[i]);
+            }
+            newestTick = std::max(newestTick, c.lastTickTime[i]);
+        }
+
+        // Drawn through its sector's impostor cell
+        if (impostors.isOwnerHidden(i)) {
+            continue;
+        }
 
-        obj.worldMatrix = glm::translate(glm::mat4(1.0f), pos)
-                        * glm::scale(glm::mat4(1.0f), scale);
+        ObjectData& obj = objectData[objectCount++];
+        glm::vec3 pos = c.position[i];
+        glm::vec3 scale(c.baseScale[i].x, c.currentHeight[i], c.baseScale[i].z);
+
+        // translate(pos) * scale(scale), written out
+        obj.worldMatrix = glm::mat4(
+            scale.x, 0.0f,    0.0f,    0.0f,
+            0.0f,    scale.y, 0.0f,    0.0f,
+            0.0f,    0.0f,    scale.z, 0.0f,
+            pos.x,   pos.y,   pos.z,   1.0f
+        );
 
         // AABB: mesh is unit cube [(-0.5,0,-0.5) to (0.5,1,0.5)]
         // After scale+translate: min = pos + (-0.5*sx, 0, -0.5*sz), max = pos + (0.5*sx, height, 0.5*sz)
@@ -446,14 +780,15 @@ void BuildingManager::updateObjectBuffer() {
         obj.boundingBoxMax = glm::vec4(pos.x + scale.x * 0.5f, pos.y + scale.y, pos.z + scale.z * 0.5f, 0.0f);
 
         // Material
-        glm::vec4 colorVec4 = building.getColor();
+        glm::vec4 colorVec4 = BuildingEntity::colorForPriceChange(c.priceChangePercent[i]);
         obj.colorAndMetallic = glm::vec4(colorVec4.r, colorVec4.g, colorVec4.b, 0.3f);  // metallic=0.3
         obj.roughnessAOPad = glm::vec4(0.4f, 1.0f, 0.0f, 0.0f);  // roughness=0.4, ao=1.0
-
-        objectData.push_back(obj);
     }
 
-    size_t objectCount = objectData.size();
+    // Distant sectors: one box per impostor cell
+    objectData.resize(objectCount);
+    objectCount += impostors.appendObjects(objectData);
+
     size_t requiredSize = sizeof(ObjectData) * objectCount;
 
     // Only recreate buffer when capacity is insufficient
@@ -473,6 +808,8 @@ void BuildingManager::updateObjectBuffer() {
     auto& currentBuffer = objectBuffers[currentBufferIndex];
     if (currentBuffer) {
         currentBuffer->write(objectData.data(), requiredSize);
+        uploadedObjectCount = static_cast<uint32_t>(objectCount);
         objectBufferDirty = false;
     }
+    uploadedTickCutoff = newestTick;
 }
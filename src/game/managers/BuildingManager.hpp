@@ -1,15 +1,21 @@
 #pragma once
 
 #include "src/game/entities/BuildingEntity.hpp"
+#include "src/game/entities/BuildingStore.hpp"
 #include "src/game/sync/PriceUpdate.hpp"
-#include "src/game/utils/AnimationUtils.hpp"
+#include "src/game/utils/AnimationPool.hpp"
 #include "src/game/utils/HeightCalculator.hpp"
+#include "src/game/world/SectorAggregates.hpp"
+#include "src/game/world/SectorImpostors.hpp"
+#include "src/game/world/SpatialGrid.hpp"
 #include "src/rendering/InstancedRenderData.hpp"
 #include "src/scene/Mesh.hpp"
+#include "src/utils/LatencyTracer.hpp"
 #include <rhi/RHI.hpp>
 
 #include <array>
-#include <unordered_map>
+#include <optional>
+#include <span>
 #include <vector>
 #include <memory>
 #include <string>
@@ -17,6 +23,18 @@
 
 // Forward declarations
 class Material;
+namespace worldsnapshot { struct BuildingView; }
+
+/**
+ * @brief Parameters of one building for BuildingManager::createBuildings()
+ */
+struct BuildingSpawnDesc {
+    std::string ticker;                     // Ticker symbol (e.g., "AAPL")
+    std::string sectorId;                   // Sector ID (e.g., "NASDAQ")
+    glm::vec3 position{0.0f};               // World position
+    float initialPrice = 0.0f;              // Initial price
+    SymbolId symbol = INVALID_SYMBOL;       // Interned ticker, if the caller already has it
+};
 
 /**
  * @brief Manages lifecycle of all building entities
@@ -27,6 +45,10 @@ class Material;
  * - Update animations every frame
  * - Provide renderable data to the rendering system
  * - Manage shared resources (meshes, materials)
+ *
+ * Buildings are kept in a structure-of-arrays BuildingStore. Entity IDs are
+ * packed generational BuildingHandles, so lookups are an index plus a
+ * generation check and IDs of destroyed buildings stay invalid.
  */
 class BuildingManager {
 public:
@@ -65,6 +87,31 @@ public:
         float initialPrice
     );
 
+    /**
+     * @brief Create many buildings at once
+     * @param descs Buildings to create
+     * @param outEntityIds Receives each desc's entity ID (0 if its ticker
+     *        already exists or repeats earlier in descs); empty to skip,
+     *        otherwise at least descs.size() long
+     * @return Number of buildings created
+     *
+     * Same result as createBuilding() per desc, but capacity is reserved
+     * once, entities are initialized in parallel chunks on the shared
+     * ThreadPool, and the object buffer is marked dirty once.
+     * Logs spawn throughput.
+     */
+    size_t createBuildings(std::span<const BuildingSpawnDesc> descs, std::span<uint64_t> outEntityIds = {});
+
+    /**
+     * @brief Replace every building with a snapshot's (see WorldSnapshot.hpp)
+     * @param view Mapped snapshot buildings
+     *
+     * Columns are copied wholesale and records filled in parallel chunks;
+     * only the hash-based indices and per-sector state are rebuilt serially.
+     * Running animations resume where they were saved. Entity IDs are new.
+     */
+    void restoreBuildings(const worldsnapshot::BuildingView& view);
+
     /**
      * @brief Destroy a building entity by ID
      * @param entityId Entity ID to destroy
@@ -88,6 +135,14 @@ public:
 
     /**
      * @brief Update price for a single building
+     * @param symbol Interned ticker symbol
+     * @param newPrice New price
+     * @return True if building found and updated
+     */
+    bool updatePrice(SymbolId symbol, float newPrice);
+
+    /**
+     * @brief Update price by ticker string (looks the symbol up; not for hot paths)
      * @param ticker Ticker symbol
      * @param newPrice New price
      * @return True if building found and updated
@@ -97,52 +152,143 @@ public:
     /**
      * @brief Batch update prices for multiple buildings
      * @param updates Vector of price updates
+     * @param applyTime latency::now() of this simulation step, stored per building
+     *        so the upload that makes the tick visible can report it
      */
-    void batchUpdatePrices(const PriceUpdateBatch& updates);
+    void batchUpdatePrices(const PriceUpdateBatch& updates, uint64_t applyTime = latency::now());
+
+    /**
+     * @brief Show a recorded price state (timeline scrubbing)
+     * @param symbols Symbols to set; symbols without a building are skipped
+     * @param prices Price per symbol
+     * @param previousPrices Previous price per symbol
+     * @return Number of buildings updated
+     *
+     * Heights, change percentages, sector statistics and impostors follow
+     * the prices immediately; running animations and particle effects stop.
+     */
+    size_t applyPriceState(std::span<const SymbolId> symbols, std::span<const float> prices,
+                           std::span<const float> previousPrices);
 
     // ========== Queries ==========
 
     /**
-     * @brief Get building by entity ID
+     * @brief Get a snapshot of a building by entity ID
      * @param entityId Entity ID
-     * @return Pointer to building (nullptr if not found)
+     * @return Building snapshot (empty if not found)
      */
-    BuildingEntity* getBuilding(uint64_t entityId);
+    std::optional<BuildingEntity> getBuilding(uint64_t entityId) const;
 
     /**
-     * @brief Get building by ticker symbol
+     * @brief Get a snapshot of a building by ticker symbol
      * @param ticker Ticker symbol
-     * @return Pointer to building (nullptr if not found)
+     * @return Building snapshot (empty if not found)
      */
-    BuildingEntity* getBuildingByTicker(const std::string& ticker);
+    std::optional<BuildingEntity> getBuildingByTicker(const std::string& ticker) const;
+
+    /**
+     * @brief Get a snapshot of a building by interned symbol
+     * @param symbol Symbol ID
+     * @return Building snapshot (empty if not found)
+     */
+    std::optional<BuildingEntity> getBuildingBySymbol(SymbolId symbol) const;
+
+    /**
+     * @brief Resolve a symbol to its entity ID
+     * @param symbol Symbol ID
+     * @return Entity ID (0 if no building has this symbol)
+     */
+    uint64_t getEntityId(SymbolId symbol) const {
+        return symbol < symbolToEntityId.size() ? symbolToEntityId[symbol] : 0;
+    }
 
     /**
      * @brief Get all buildings in a specific sector
      * @param sectorId Sector ID
-     * @return Vector of building pointers
+     * @return Entity IDs
      */
-    std::vector<BuildingEntity*> getBuildingsInSector(const std::string& sectorId);
+    std::vector<uint64_t> getBuildingsInSector(const std::string& sectorId) const;
 
     /**
-     * @brief Get all buildings
-     * @return Vector of building pointers
+     * @brief Column-wise access to all buildings (for linear queries)
      */
-    std::vector<BuildingEntity*> getAllBuildings();
+    const BuildingStore& getStore() const {
+        return store;
+    }
+
+    /**
+     * @brief Grid of building positions for radius / nearest / rectangle queries
+     *
+     * Entries are entity IDs; kept current by create and destroy.
+     */
+    const SpatialGrid& getSpatialIndex() const {
+        return spatialIndex;
+    }
+
+    /**
+     * @brief Set the spatial index cell size (re-buckets existing buildings)
+     * @param cellSize Cell edge in meters, ideally the building spacing
+     */
+    void setSpatialCellSize(float cellSize) {
+        spatialIndex.setCellSize(cellSize);
+    }
+
+    /**
+     * @brief Running per-sector statistics, kept current by create, destroy and price updates
+     *
+     * Owner indices in summaries are dense store indices.
+     */
+    const SectorAggregates& getSectorAggregates() const {
+        return sectorAggregates;
+    }
+
+    /**
+     * @brief Per-sector data for sector-level render effects
+     *
+     * Rebuilt from the aggregates (one entry per sector, no building scan)
+     * only when they changed since the last call; valid until the next call.
+     */
+    std::span<const rendering::SectorRenderData> getSectorRenderData();
 
     /**
      * @brief Get total building count
      * @return Number of buildings
      */
     size_t getBuildingCount() const {
-        return entities.size();
+        return store.size();
+    }
+
+    /**
+     * @brief Buildings ever spawned or restored (never decreases)
+     *
+     * Unlike the building count it changes when a destroy and a spawn
+     * cancel out, so it tells whether any building may be new.
+     */
+    uint64_t getSpawnCount() const {
+        return spawnCount;
     }
 
+    /**
+     * @brief Set a building's height immediately (no animation)
+     * @param entityId Entity ID
+     * @param height New height in meters
+     * @return True if the building exists
+     */
+    bool setBuildingHeight(uint64_t entityId, float height);
+
     /**
      * @brief Get number of animating buildings
      * @return Number of buildings currently animating
      */
     size_t getAnimatingCount() const {
-        return animatingEntities.size();
+        return animations.size();
+    }
+
+    /**
+     * @brief Running height animations (owners are dense store indices)
+     */
+    const AnimationPool& getAnimations() const {
+        return animations;
     }
 
     // ========== Update Loop ==========
@@ -177,6 +323,29 @@ public:
 
     // ========== GPU Object Buffer (Phase 2.1 SSBO) ==========
 
+    /**
+     * @brief Switch distant sectors to impostor cells (and near ones back)
+     * @param viewerPosition Camera position
+     *
+     * Call once per frame before updateObjectBuffer(); marks the buffer
+     * dirty when any sector switched.
+     */
+    void updateLod(const glm::vec3& viewerPosition);
+
+    /**
+     * @brief Set the viewer distance beyond which sectors draw as impostors (0 disables)
+     */
+    void setImpostorDistance(float distance) {
+        impostors.setDistance(distance);
+    }
+
+    /**
+     * @brief Impostor state (distance, sectors currently drawn as cells)
+     */
+    const SectorImpostors& getImpostors() const {
+        return impostors;
+    }
+
     /**
      * @brief Get object buffer (SSBO) for GPU-driven rendering
      * @return Pointer to SSBO (may be null if not created)
@@ -187,10 +356,30 @@ public:
 
     /**
      * @brief Update object buffer with current building data
-     * Computes world matrices and AABB for all objects.
+     * Computes world matrices and AABB for all objects. Slot 0 is the
+     * ground; buildings follow in Morton (Z-order) order of their XZ
+     * position, so neighbouring slots hold neighbouring buildings.
+     * Buildings of impostor sectors are replaced by their sectors' cells,
+     * appended last.
      */
     void updateObjectBuffer();
 
+    /**
+     * @brief Number of objects written by the last updateObjectBuffer() (ground included)
+     */
+    uint32_t getObjectCount() const {
+        return uploadedObjectCount;
+    }
+
+    /**
+     * @brief Apply times of ticks made visible by object buffer uploads since the last call
+     * @param out Receives one lastTickTime per building uploaded with a new tick (cleared first)
+     */
+    void takeUploadedTickTimes(std::vector<uint64_t>& out) {
+        out.clear();
+        out.swap(uploadedTickTimes);
+    }
+
     /**
      * @brief Check if object buffer needs update
      * @return True if buffer is dirty and needs update
@@ -212,8 +401,13 @@ private:
     rhi::RHIQueue* graphicsQueue;
 
     // ========== Entity Storage ==========
-    std::unordered_map<uint64_t, BuildingEntity> entities;          // entityId -> BuildingEntity
-    std::unordered_map<std::string, uint64_t> tickerToEntityId;     // ticker -> entityId
+    BuildingStore store;                                            // SoA building data
+    std::vector<uint64_t> symbolToEntityId;                         // SymbolId -> entityId (0 = none)
+    SpatialGrid spatialIndex;                                       // Positions -> entityId
+    SectorAggregates sectorAggregates;                              // Per-sector running stats, owners = dense index
+    std::vector<rendering::SectorRenderData> sectorRenderData;      // Cache for getSectorRenderData()
+    uint64_t sectorRenderVersion = ~0ull;                           // Aggregates version it was built from
+    uint64_t spawnCount = 0;                                        // For getSpawnCount()
 
     // ========== Shared Resources ==========
     std::unique_ptr<Mesh> buildingMesh;                             // Shared building mesh
@@ -223,13 +417,79 @@ private:
     std::array<std::unique_ptr<rhi::RHIBuffer>, NUM_OBJECT_BUFFERS> objectBuffers;
     size_t currentBufferIndex = 0;
     size_t currentBufferCapacity = 0;
+    uint32_t uploadedObjectCount = 0;
     bool objectBufferDirty = true;
+    static constexpr size_t MAX_PENDING_TICK_TIMES = 1u << 20;
+    uint64_t uploadedTickCutoff = 0;                                // Newest lastTickTime already uploaded
+    std::vector<uint64_t> uploadedTickTimes;                        // Pending for takeUploadedTickTimes()
+
+    // ========== Instance Order ==========
+    static constexpr float MORTON_CELL_SIZE = 4.0f;                 // Meters per Morton grid cell
+
+    /**
+     * @brief One building's place in the object buffer
+     */
+    struct InstanceSlot {
+        uint64_t key;       // Morton code << 32 | handle slot (stable, unique)
+        uint32_t index;     // Dense store index
+    };
+    std::vector<InstanceSlot> instanceOrder;                        // Sorted by key up to sortedInstanceCount
+    size_t sortedInstanceCount = 0;                                 // Spawned since then: unsorted tail
+    size_t instanceTombstones = 0;                                  // Destroyed entries (index = INVALID_INDEX)
+
+    // ========== Level of Detail ==========
+    SectorImpostors impostors;                                      // Distant sectors as aggregated cells, owners = dense index
 
-    // ========== Animation Queue ==========
-    std::vector<uint64_t> animatingEntities;                        // List of entities currently animating
+    // ========== Animations ==========
+    AnimationPool animations;                                       // Running height animations, keyed by dense index
 
     // ========== Helper Functions ==========
 
+    /**
+     * @brief Resolve an entity ID to its dense store index
+     * @param entityId Entity ID
+     * @return Dense index (BuildingStore::INVALID_INDEX if stale or unknown)
+     */
+    uint32_t findIndex(uint64_t entityId) const {
+        return store.indexOf(BuildingHandle::fromBits(entityId));
+    }
+
+    /**
+     * @brief Object buffer ordering key of a building
+     * @param index Dense store index
+     */
+    uint64_t instanceKey(uint32_t index) const;
+
+    /**
+     * @brief Drop destroyed entries and sort buildings spawned since the last call into instanceOrder
+     */
+    void flushInstanceOrder();
+
+    /**
+     * @brief Find a live building's entry in the sorted part of instanceOrder
+     * @param index Dense store index (its entry must not be in the unsorted tail)
+     */
+    std::vector<InstanceSlot>::iterator findInstanceSlot(uint32_t index);
+
+    /**
+     * @brief Apply a new price to one building
+     * @param symbol Interned ticker symbol
+     * @param newPrice New price
+     * @param volume Traded volume of the tick (0 if not reported)
+     * @param timestamp Update time (milliseconds since epoch)
+     * @return Dense index of the building (BuildingStore::INVALID_INDEX if none)
+     */
+    uint32_t applyPrice(SymbolId symbol, float newPrice, float volume, uint64_t timestamp);
+
+    /**
+     * @brief Sector aggregate sample of one building
+     * @param index Dense store index
+     */
+    SectorSample sectorSample(uint32_t index) const {
+        const BuildingColumns& c = store.columns();
+        return SectorSample{c.currentPrice[index], c.priceChangePercent[index], c.tickVolume[index]};
+    }
+
     /**
      * @brief Calculate building height from price
      * @param price Current price
@@ -239,11 +499,11 @@ private:
     float calculateHeight(float price, float basePrice);
 
     /**
-     * @brief Update animation for a single entity
-     * @param entity Building entity to update
-     * @param deltaTime Time since last frame
+     * @brief Pick the easing curve for a height animation
+     * @param priceChangePercent Percentage change that started it
+     * @return Easing curve
      */
-    void updateAnimation(BuildingEntity& entity, float deltaTime);
+    static EasingCurve determineEasingCurve(float priceChangePercent);
 
     /**
      * @brief Determine particle effect type based on price change
@@ -251,13 +511,4 @@ private:
      * @return Particle effect type
      */
     ParticleEffectType determineParticleEffect(float priceChangePercent);
-
-    /**
-     * @brief Generate unique entity ID
-     * @return New unique entity ID
-     */
-    uint64_t generateEntityId();
-
-    // ========== ID Generation ==========
-    uint64_t nextEntityId;
 };
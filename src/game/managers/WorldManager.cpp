@@ -1,6 +1,9 @@
 #include "WorldManager.hpp"
+#include "src/game/world/WorldSnapshot.hpp"
 #include "src/utils/Logger.hpp"
 #include <algorithm>
+#include <chrono>
+#include <limits>
 
 WorldManager::WorldManager(rhi::RHIDevice* device, rhi::RHIQueue* queue)
     : rhiDevice(device)
@@ -8,6 +11,8 @@ WorldManager::WorldManager(rhi::RHIDevice* device, rhi::RHIQueue* queue)
     , sectors()
     , sectorIdToIndex()
     , buildingManager(std::make_unique<BuildingManager>(device, queue))
+    , priceHistory()
+    , worldHistory()
 {
 }
 
@@ -24,6 +29,15 @@ void WorldManager::initialize() {
               << sectors.size() << " sectors created";
 }
 
+bool WorldManager::initializeFromSnapshot(const std::string& snapshotPath) {
+    buildingManager->createDefaultMesh();
+    if (!worldsnapshot::load(*this, snapshotPath)) {
+        return false;
+    }
+    clearTimeline();
+    return true;
+}
+
 void WorldManager::initializeFromConfig(const std::string& configPath) {
     // TODO: Load configuration from JSON file
     // For now, just use default initialization
@@ -45,12 +59,22 @@ void WorldManager::createSector(const Sector& sector) {
 
     // Calculate grid dimensions
     sectors[index].calculateGridDimensions();
+    updateSpatialCellSize();
 
     LOG_DEBUG("WorldManager") << "Created sector '" << sectors[index].id
               << "' with " << sectors[index].maxBuildings << " slots ("
               << sectors[index].gridRows << "x" << sectors[index].gridColumns << " grid)";
 }
 
+void WorldManager::replaceSectors(std::vector<Sector> newSectors) {
+    sectors = std::move(newSectors);
+    sectorIdToIndex.clear();
+    for (size_t i = 0; i < sectors.size(); ++i) {
+        sectorIdToIndex[sectors[i].id] = i;
+    }
+    updateSpatialCellSize();
+}
+
 Sector* WorldManager::getSector(const std::string& sectorId) {
     auto it = sectorIdToIndex.find(sectorId);
     if (it != sectorIdToIndex.end()) {
@@ -111,46 +135,111 @@ void WorldManager::spawnMultipleBuildings(
               << "/" << tickers.size() << " buildings";
 }
 
-void WorldManager::updateMarketData(const PriceUpdateBatch& updates) {
-    buildingManager->batchUpdatePrices(updates);
-}
+void WorldManager::updateMarketData(const PriceUpdateBatch& updates, uint64_t applyTime,
+                                    std::span<const TickWindow> windows) {
+    // Buildings that predate their first tick enter the timeline at their spawn price
+    seedTimeline();
 
-void WorldManager::update(float deltaTime) {
-    // Update building animations
-    buildingManager->update(deltaTime);
+    if (!scrubbing) {
+        buildingManager->batchUpdatePrices(updates, applyTime);
+    }
+
+    uint64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    if (windows.empty()) {
+        priceHistory.record(updates, nowMs);
+    } else {
+        priceHistory.record(windows, nowMs);
+    }
+
+    // The timeline runs on market time, like the candles (the clock only
+    // stands in for feeds without timestamps)
+    uint64_t marketTime = 0;
+    for (const auto& update : updates) {
+        marketTime = std::max(marketTime, update.timestamp);
+    }
+    worldHistory.record(updates, marketTime != 0 ? marketTime : nowMs);
 }
 
-BuildingEntity* WorldManager::getBuildingAtPosition(const glm::vec3& worldPos, float radius) {
-    BuildingEntity* nearest = nullptr;
-    float nearestDistance = radius;
+bool WorldManager::scrubTo(uint64_t timestamp) {
+    seedTimeline();
+    if (!worldHistory.reconstruct(timestamp, scrubState)) {
+        return false;
+    }
 
-    auto buildings = buildingManager->getAllBuildings();
-    for (auto* building : buildings) {
-        float distance = glm::length(building->position - worldPos);
-        if (distance < nearestDistance) {
-            nearestDistance = distance;
-            nearest = building;
-        }
+    showTimelineState(scrubState);
+    scrubbing = true;
+    scrubTime = scrubState.timestamp;
+    return true;
+}
+
+void WorldManager::resumeLive() {
+    if (!scrubbing) {
+        return;
     }
 
-    return nearest;
+    // The history's newest state is the live one
+    if (worldHistory.reconstruct(worldHistory.getNewestTime(), scrubState)) {
+        showTimelineState(scrubState);
+    }
+    scrubbing = false;
+    scrubTime = 0;
 }
 
-std::vector<BuildingEntity*> WorldManager::getBuildingsInRadius(
-    const glm::vec3& center,
-    float radius
-) {
-    std::vector<BuildingEntity*> result;
-    auto buildings = buildingManager->getAllBuildings();
+void WorldManager::clearTimeline() {
+    worldHistory.clear();
+    timelineSeedSpawns = UINT64_MAX;
+    scrubbing = false;
+    scrubTime = 0;
+}
 
-    for (auto* building : buildings) {
-        float distance = glm::length(building->position - center);
-        if (distance <= radius) {
-            result.push_back(building);
-        }
+void WorldManager::seedTimeline() {
+    // Only buildings spawned since the last seed can be unknown to the timeline
+    // (the spawn count, unlike the building count, sees a destroy + spawn)
+    if (buildingManager->getSpawnCount() == timelineSeedSpawns) {
+        return;
     }
 
-    return result;
+    const BuildingColumns& columns = buildingManager->getStore().columns();
+    worldHistory.seed(columns.symbol, columns.currentPrice, columns.previousPrice);
+    timelineSeedSpawns = buildingManager->getSpawnCount();
+}
+
+void WorldManager::showTimelineState(const WorldHistory::State& state) {
+    auto start = std::chrono::steady_clock::now();
+    size_t applied = buildingManager->applyPriceState(state.symbol, state.price, state.previousPrice);
+
+    auto stats = worldHistory.getStats();
+    double applyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    LOG_DEBUG("WorldManager") << "Timeline state of " << state.timestamp << ": " << applied << " buildings, "
+                              << "reconstructed in " << stats.lastReconstructMs << " ms ("
+                              << stats.lastReconstructDeltas << " deltas), applied in " << applyMs << " ms";
+}
+
+void WorldManager::update(float deltaTime) {
+    // Update building animations
+    buildingManager->update(deltaTime);
+}
+
+uint64_t WorldManager::getBuildingAtPosition(const glm::vec3& worldPos, float radius) const {
+    return buildingManager->getSpatialIndex().findNearest(worldPos, radius);
+}
+
+size_t WorldManager::getBuildingsInRadius(
+    const glm::vec3& center,
+    float radius,
+    std::span<uint64_t> out
+) const {
+    return buildingManager->getSpatialIndex().queryRadius(center, radius, out);
+}
+
+size_t WorldManager::getBuildingsInRect(
+    const glm::vec2& min,
+    const glm::vec2& max,
+    std::span<uint64_t> out
+) const {
+    return buildingManager->getSpatialIndex().queryRect(min, max, out);
 }
 
 glm::vec3 WorldManager::allocatePositionInSector(const std::string& sectorId) {
@@ -166,6 +255,19 @@ glm::vec3 WorldManager::allocatePositionInSector(const std::string& sectorId) {
     return sector->getGridPosition(index);
 }
 
+void WorldManager::updateSpatialCellSize() {
+    // Spatial index cells follow the densest sector layout
+    float minSpacing = std::numeric_limits<float>::max();
+    for (const Sector& existing : sectors) {
+        if (existing.buildingSpacing > 0.0f) {
+            minSpacing = std::min(minSpacing, existing.buildingSpacing);
+        }
+    }
+    if (minSpacing < std::numeric_limits<float>::max()) {
+        buildingManager->setSpatialCellSize(minSpacing);
+    }
+}
+
 void WorldManager::createDefaultSectors() {
     // Sector 1: NASDAQ
     Sector nasdaq;
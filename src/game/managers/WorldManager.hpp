@@ -2,9 +2,12 @@
 
 #include "BuildingManager.hpp"
 #include "src/game/world/Sector.hpp"
+#include "src/game/sync/PriceHistory.hpp"
 #include "src/game/sync/PriceUpdate.hpp"
+#include "src/game/sync/WorldHistory.hpp"
 #include <rhi/RHI.hpp>
 
+#include <span>
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -47,6 +50,13 @@ public:
      */
     void initialize();
 
+    /**
+     * @brief Initialize world from a binary snapshot (see WorldSnapshot.hpp)
+     * @param snapshotPath Snapshot written by worldsnapshot::save()
+     * @return False if the snapshot could not be loaded (the world is left unchanged)
+     */
+    bool initializeFromSnapshot(const std::string& snapshotPath);
+
     /**
      * @brief Initialize world from configuration file (future)
      * @param configPath Path to world.json
@@ -76,6 +86,12 @@ public:
         return sectors;
     }
 
+    /**
+     * @brief Replace every sector (snapshot restore); buildings are not touched
+     * @param newSectors Sectors with their grid dimensions and counts already set
+     */
+    void replaceSectors(std::vector<Sector> newSectors);
+
     // ========== Building Management ==========
 
     /**
@@ -105,9 +121,19 @@ public:
 
     /**
      * @brief Update market data (from DataSyncClient)
+     *
+     * Also folds the batch into the price history and the world timeline,
+     * both on the ticks' market time (the newest timestamp in the batch; the
+     * wall clock only when the ticks carry none). While scrubbing, buildings
+     * keep showing the past and the batch only extends the histories.
+     *
      * @param updates Price update batch
+     * @param applyTime latency::now() of this simulation step (for latency tracing)
+     * @param windows MarketDataQueue tick windows behind the batch; candles are
+     *        built from these when given, otherwise from the updates
      */
-    void updateMarketData(const PriceUpdateBatch& updates);
+    void updateMarketData(const PriceUpdateBatch& updates, uint64_t applyTime = latency::now(),
+                          std::span<const TickWindow> windows = {});
 
     // ========== Update Loop ==========
 
@@ -119,21 +145,86 @@ public:
 
     // ========== Queries ==========
 
+    // Spatial queries go through BuildingManager's SpatialGrid (cells sized to
+    // the sector building spacing) and touch only the cells they overlap.
+
     /**
      * @brief Get building at world position
      * @param worldPos World position
      * @param radius Search radius
-     * @return Pointer to nearest building (nullptr if none found)
+     * @return Entity ID of nearest building (0 if none found)
      */
-    BuildingEntity* getBuildingAtPosition(const glm::vec3& worldPos, float radius = 10.0f);
+    uint64_t getBuildingAtPosition(const glm::vec3& worldPos, float radius = 10.0f) const;
 
     /**
      * @brief Get all buildings in radius
      * @param center Center position
      * @param radius Search radius
-     * @return Vector of building pointers
+     * @param out Receives entity IDs (up to out.size())
+     * @return Number of buildings in radius (may exceed out.size())
+     */
+    size_t getBuildingsInRadius(const glm::vec3& center, float radius, std::span<uint64_t> out) const;
+
+    /**
+     * @brief Get all buildings inside an XZ rectangle
+     * @param min Minimum corner (x, z)
+     * @param max Maximum corner (x, z)
+     * @param out Receives entity IDs (up to out.size())
+     * @return Number of buildings inside (may exceed out.size())
+     */
+    size_t getBuildingsInRect(const glm::vec2& min, const glm::vec2& max, std::span<uint64_t> out) const;
+
+    /**
+     * @brief Per-symbol OHLC history (sparklines, candlesticks)
      */
-    std::vector<BuildingEntity*> getBuildingsInRadius(const glm::vec3& center, float radius);
+    PriceHistory& getPriceHistory() {
+        return priceHistory;
+    }
+
+    const PriceHistory& getPriceHistory() const {
+        return priceHistory;
+    }
+
+    // ========== Timeline ==========
+
+    /**
+     * @brief Show the world as it was at a past time
+     * @param timestamp Milliseconds since epoch (clamped to the newest recorded time)
+     * @return False if the time is older than the retained history
+     */
+    bool scrubTo(uint64_t timestamp);
+
+    /**
+     * @brief Leave scrubbing: show the latest prices and apply live ticks again
+     */
+    void resumeLive();
+
+    bool isScrubbing() const {
+        return scrubbing;
+    }
+
+    /**
+     * @brief Time of the state shown while scrubbing
+     */
+    uint64_t getScrubTime() const {
+        return scrubTime;
+    }
+
+    /**
+     * @brief Forget the timeline and stop scrubbing
+     *
+     * For when the buildings were replaced or market time jumped (replay
+     * start or seek). Does not redraw: call resumeLive() first if the
+     * current buildings should leave a scrubbed state.
+     */
+    void clearTimeline();
+
+    /**
+     * @brief Keyframe + delta record of every symbol's price
+     */
+    const WorldHistory& getWorldHistory() const {
+        return worldHistory;
+    }
 
     /**
      * @brief Get BuildingManager (for advanced queries)
@@ -143,6 +234,10 @@ public:
         return buildingManager.get();
     }
 
+    const BuildingManager* getBuildingManager() const {
+        return buildingManager.get();
+    }
+
     // ========== Statistics ==========
 
     /**
@@ -173,6 +268,14 @@ private:
     // ========== Managers ==========
     std::unique_ptr<BuildingManager> buildingManager;
 
+    // ========== Market History ==========
+    PriceHistory priceHistory;
+    WorldHistory worldHistory;
+    WorldHistory::State scrubState;                 // Reused by scrubTo()
+    uint64_t timelineSeedSpawns = UINT64_MAX;       // Spawn count when the timeline was last seeded
+    uint64_t scrubTime = 0;
+    bool scrubbing = false;
+
     // ========== Helper Functions ==========
 
     /**
@@ -182,6 +285,21 @@ private:
      */
     glm::vec3 allocatePositionInSector(const std::string& sectorId);
 
+    /**
+     * @brief Give the timeline the prices of buildings that have not ticked yet
+     */
+    void seedTimeline();
+
+    /**
+     * @brief Show a reconstructed state on the buildings
+     */
+    void showTimelineState(const WorldHistory::State& state);
+
+    /**
+     * @brief Size spatial index cells to the densest sector layout
+     */
+    void updateSpatialCellSize();
+
     /**
      * @brief Create default sectors (NASDAQ, KOSDAQ, CRYPTO)
      */
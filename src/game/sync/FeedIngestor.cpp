@@ -0,0 +1,382 @@
+#include "FeedIngestor.hpp"
+#include "MarketDataQueue.hpp"
+#include "src/utils/Logger.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+namespace {
+
+constexpr size_t INITIAL_RECEIVE_BUFFER = 1u << 20;
+constexpr size_t MAX_RECEIVE_BUFFER = sizeof(tickwire::TickFrameHeader) + tickwire::MAX_FRAME_PAYLOAD;
+constexpr int SOCKET_RECEIVE_BUFFER = 4 << 20;
+constexpr int CONNECT_TIMEOUT_MS = 1000;
+constexpr uint32_t MIN_BACKOFF_MS = 100;
+constexpr uint32_t MAX_BACKOFF_MS = 5000;
+
+bool setNonBlocking(int fd) {
+    int flags = ::fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/**
+ * @brief Wait until fd is readable/writable or the timeout expires
+ */
+bool waitFor(int fd, short events, int timeoutMs) {
+    pollfd entry{fd, events, 0};
+    int result;
+    do {
+        result = ::poll(&entry, 1, timeoutMs);
+    } while (result < 0 && errno == EINTR);
+    return result > 0;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// FeedEndpoint
+// ============================================================================
+
+bool FeedEndpoint::parse(const std::string& text, FeedEndpoint& out) {
+    constexpr std::string_view tcpScheme = "tcp://";
+    constexpr std::string_view unixScheme = "unix://";
+
+    std::string_view view(text);
+    if (view.starts_with(unixScheme)) {
+        out.kind = Kind::Unix;
+        out.path = std::string(view.substr(unixScheme.size()));
+        return !out.path.empty() && out.path.size() < sizeof(sockaddr_un::sun_path);
+    }
+
+    if (view.starts_with(tcpScheme)) {
+        view.remove_prefix(tcpScheme.size());
+    }
+    size_t colon = view.rfind(':');
+    if (colon == std::string_view::npos || colon == 0) {
+        return false;
+    }
+
+    uint16_t port = 0;
+    std::string_view portText = view.substr(colon + 1);
+    auto [end, error] = std::from_chars(portText.data(), portText.data() + portText.size(), port);
+    if (error != std::errc() || end != portText.data() + portText.size() || port == 0) {
+        return false;
+    }
+
+    out.kind = Kind::Tcp;
+    out.host = std::string(view.substr(0, colon));
+    out.port = port;
+    return true;
+}
+
+std::string FeedEndpoint::toString() const {
+    if (kind == Kind::Unix) {
+        return "unix://" + path;
+    }
+    return "tcp://" + host + ":" + std::to_string(port);
+}
+
+// ============================================================================
+// FeedIngestor
+// ============================================================================
+
+FeedIngestor::FeedIngestor(MarketDataQueue& queue_)
+    : queue(queue_)
+{
+    setWatermarks(0.75f, 0.25f);
+}
+
+FeedIngestor::~FeedIngestor() {
+    stop();
+}
+
+bool FeedIngestor::start(const FeedEndpoint& endpoint_) {
+    if (running.load()) {
+        return false;
+    }
+    if (::pipe(wakePipe) != 0) {
+        LOG_ERROR("FeedIngestor") << "Failed to create wake pipe: " << std::strerror(errno);
+        return false;
+    }
+    setNonBlocking(wakePipe[0]);
+
+    endpoint = endpoint_;
+    receiveBuffer.resize(INITIAL_RECEIVE_BUFFER);
+    running.store(true);
+    thread = std::thread(&FeedIngestor::threadMain, this);
+
+    LOG_INFO("FeedIngestor") << "Ingesting from " << endpoint.toString();
+    return true;
+}
+
+void FeedIngestor::stop() {
+    if (!thread.joinable()) {
+        return;
+    }
+    running.store(false);
+    wake();
+    thread.join();
+
+    ::close(wakePipe[0]);
+    ::close(wakePipe[1]);
+    wakePipe[0] = wakePipe[1] = -1;
+    LOG_INFO("FeedIngestor") << "Stopped (" << tickCount.load() << " ticks ingested)";
+}
+
+void FeedIngestor::setWatermarks(float high, float low) {
+    float capacity = static_cast<float>(queue.getCapacity());
+    highWatermark = static_cast<uint32_t>(capacity * std::clamp(high, 0.0f, 1.0f));
+    lowWatermark = std::min(highWatermark, static_cast<uint32_t>(capacity * std::clamp(low, 0.0f, 1.0f)));
+}
+
+FeedIngestor::Stats FeedIngestor::getStats() const {
+    Stats stats;
+    stats.connected = connected.load(std::memory_order_relaxed);
+    stats.throttled = throttled.load(std::memory_order_relaxed);
+    stats.bytesReceived = bytesReceived.load(std::memory_order_relaxed);
+    stats.frames = frameCount.load(std::memory_order_relaxed);
+    stats.ticks = tickCount.load(std::memory_order_relaxed);
+    stats.rejected = rejectedCount.load(std::memory_order_relaxed);
+    stats.throttleEvents = throttleCount.load(std::memory_order_relaxed);
+    stats.connects = connectCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void FeedIngestor::wake() {
+    if (wakePipe[1] >= 0) {
+        char byte = 1;
+        [[maybe_unused]] ssize_t written = ::write(wakePipe[1], &byte, 1);
+    }
+}
+
+void FeedIngestor::threadMain() {
+    uint32_t backoffMs = MIN_BACKOFF_MS;
+
+    while (running.load()) {
+        int socket = connectSocket();
+        if (socket < 0) {
+            // Sleep on the wake pipe so stop() interrupts the backoff
+            waitFor(wakePipe[0], POLLIN, static_cast<int>(backoffMs));
+            backoffMs = std::min(backoffMs * 2, MAX_BACKOFF_MS);
+            continue;
+        }
+
+        connectCount.fetch_add(1, std::memory_order_relaxed);
+        connected.store(true);
+        LOG_INFO("FeedIngestor") << "Connected to " << endpoint.toString();
+
+        // A new session starts with its own symbol directory
+        decoder.resetSymbols();
+        receivedBytes = 0;
+
+        auto sessionStart = std::chrono::steady_clock::now();
+        serveConnection(socket);
+
+        ::close(socket);
+        connected.store(false);
+        throttled.store(false);
+        if (!running.load()) {
+            break;
+        }
+        LOG_WARN("FeedIngestor") << "Connection to " << endpoint.toString() << " lost; reconnecting";
+
+        // Only a session that stayed up resets the backoff, so a server that
+        // accepts and immediately closes is not reconnected in a tight loop
+        if (std::chrono::steady_clock::now() - sessionStart >= std::chrono::milliseconds(MAX_BACKOFF_MS)) {
+            backoffMs = MIN_BACKOFF_MS;
+        }
+        waitFor(wakePipe[0], POLLIN, static_cast<int>(backoffMs));
+        backoffMs = std::min(backoffMs * 2, MAX_BACKOFF_MS);
+    }
+}
+
+int FeedIngestor::connectSocket() {
+    if (endpoint.kind == FeedEndpoint::Kind::Unix) {
+        int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket < 0) {
+            return -1;
+        }
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, endpoint.path.c_str(), sizeof(address.sun_path) - 1);
+        if (::connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+            || !setNonBlocking(socket)) {
+            ::close(socket);
+            return -1;
+        }
+        return socket;
+    }
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    std::string port = std::to_string(endpoint.port);
+    if (::getaddrinfo(endpoint.host.c_str(), port.c_str(), &hints, &addresses) != 0) {
+        return -1;
+    }
+
+    int socket = -1;
+    for (addrinfo* address = addresses; address && socket < 0; address = address->ai_next) {
+        socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (socket < 0) {
+            continue;
+        }
+        setNonBlocking(socket);
+        ::setsockopt(socket, SOL_SOCKET, SO_RCVBUF, &SOCKET_RECEIVE_BUFFER, sizeof(SOCKET_RECEIVE_BUFFER));
+
+        // Non-blocking connect with a timeout so stop() is never stuck behind the kernel's
+        int error = 0;
+        socklen_t length = sizeof(error);
+        bool ok = ::connect(socket, address->ai_addr, address->ai_addrlen) == 0
+            || (errno == EINPROGRESS
+                && waitFor(socket, POLLOUT, CONNECT_TIMEOUT_MS)
+                && ::getsockopt(socket, SOL_SOCKET, SO_ERROR, &error, &length) == 0
+                && error == 0);
+        if (!ok) {
+            ::close(socket);
+            socket = -1;
+        }
+    }
+    ::freeaddrinfo(addresses);
+    return socket;
+}
+
+void FeedIngestor::serveConnection(int socket) {
+#ifdef __linux__
+    int poller = ::epoll_create1(EPOLL_CLOEXEC);
+    if (poller < 0) {
+        LOG_ERROR("FeedIngestor") << "epoll_create1 failed: " << std::strerror(errno);
+        return;
+    }
+    epoll_event wakeEvent{};
+    wakeEvent.events = EPOLLIN;
+    wakeEvent.data.fd = wakePipe[0];
+    ::epoll_ctl(poller, EPOLL_CTL_ADD, wakePipe[0], &wakeEvent);
+
+    epoll_event socketEvent{};
+    socketEvent.events = EPOLLIN | EPOLLRDHUP;
+    socketEvent.data.fd = socket;
+    ::epoll_ctl(poller, EPOLL_CTL_ADD, socket, &socketEvent);
+#endif
+
+    bool open = true;
+    while (open && running.load()) {
+        // Backpressure: stop watching the socket while the frame loop catches up
+        uint32_t depth = queue.getDepth();
+        bool wasThrottled = throttled.load(std::memory_order_relaxed);
+        bool throttle = wasThrottled ? depth > lowWatermark : depth >= highWatermark;
+        if (throttle != wasThrottled) {
+            throttled.store(throttle);
+            if (throttle) {
+                throttleCount.fetch_add(1, std::memory_order_relaxed);
+            }
+#ifdef __linux__
+            ::epoll_ctl(poller, throttle ? EPOLL_CTL_DEL : EPOLL_CTL_ADD, socket, &socketEvent);
+#endif
+        }
+        // Throttled: poll the queue depth every millisecond
+        int timeoutMs = throttle ? 1 : 100;
+
+        bool socketReady = false;
+        bool wakeReady = false;
+#ifdef __linux__
+        epoll_event events[2];
+        int count = ::epoll_wait(poller, events, 2, timeoutMs);
+        for (int i = 0; i < count; ++i) {
+            if (events[i].data.fd == socket) {
+                socketReady = true;
+            } else {
+                wakeReady = true;
+            }
+        }
+#else
+        pollfd entries[2] = {{wakePipe[0], POLLIN, 0}, {socket, POLLIN, 0}};
+        int count = ::poll(entries, throttle ? 1 : 2, timeoutMs);
+        if (count > 0) {
+            wakeReady = entries[0].revents != 0;
+            socketReady = !throttle && entries[1].revents != 0;
+        }
+#endif
+        if (count < 0 && errno != EINTR) {
+            LOG_ERROR("FeedIngestor") << "Socket wait failed: " << std::strerror(errno);
+            break;
+        }
+
+        if (wakeReady) {
+            char drain[64];
+            while (::read(wakePipe[0], drain, sizeof(drain)) > 0) {}
+        }
+        if (socketReady) {
+            open = readAvailable(socket);
+        }
+    }
+
+#ifdef __linux__
+    ::close(poller);
+#endif
+}
+
+bool FeedIngestor::readAvailable(int socket) {
+    for (;;) {
+        if (receivedBytes == receiveBuffer.size()) {
+            // A single frame larger than the buffer: grow up to the largest legal frame
+            if (receiveBuffer.size() >= MAX_RECEIVE_BUFFER) {
+                LOG_ERROR("FeedIngestor") << "Frame exceeds receive buffer; dropping connection";
+                return false;
+            }
+            receiveBuffer.resize(std::min(receiveBuffer.size() * 2, MAX_RECEIVE_BUFFER));
+        }
+
+        // The queue conflates per symbol, so any amount read fits into it
+        ssize_t received = ::recv(socket, receiveBuffer.data() + receivedBytes,
+                                  receiveBuffer.size() - receivedBytes, 0);
+        if (received == 0) {
+            return false;  // Peer closed
+        }
+        if (received < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+
+        bytesReceived.fetch_add(static_cast<uint64_t>(received), std::memory_order_relaxed);
+        receivedBytes += static_cast<size_t>(received);
+
+        // Decode every complete frame in place, keep the partial tail for the next read
+        auto result = decoder.decode(std::span<const std::byte>(receiveBuffer.data(), receivedBytes), queue);
+        frameCount.fetch_add(result.frames, std::memory_order_relaxed);
+        tickCount.fetch_add(result.ticks, std::memory_order_relaxed);
+        rejectedCount.fetch_add(result.rejected, std::memory_order_relaxed);
+
+        if (result.status == TickDecoder::Status::Corrupt) {
+            LOG_ERROR("FeedIngestor") << "Corrupt frame from " << endpoint.toString() << "; dropping connection";
+            return false;
+        }
+
+        size_t remaining = receivedBytes - result.bytesConsumed;
+        if (remaining > 0 && result.bytesConsumed > 0) {
+            std::memmove(receiveBuffer.data(), receiveBuffer.data() + result.bytesConsumed, remaining);
+        }
+        receivedBytes = remaining;
+
+        // Yield to the backpressure check once the queue is full enough
+        if (queue.getDepth() >= highWatermark) {
+            return true;
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "TickCodec.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+class MarketDataQueue;
+
+/**
+ * @brief Feed server address: "tcp://host:port" or "unix:///path/to/socket"
+ */
+struct FeedEndpoint {
+    enum class Kind { Tcp, Unix };
+
+    Kind kind = Kind::Tcp;
+    std::string host = "127.0.0.1";   // Tcp
+    uint16_t port = 0;                // Tcp
+    std::string path;                 // Unix
+
+    /**
+     * @brief Parse an endpoint string
+     * @return False if the string is not a supported endpoint
+     */
+    static bool parse(const std::string& text, FeedEndpoint& out);
+
+    std::string toString() const;
+};
+
+/**
+ * @brief Dedicated network ingestion thread
+ *
+ * Connects to a feed server, waits on the socket with epoll (poll() where
+ * epoll is unavailable), reads tick wire frames into a fixed receive buffer
+ * and decodes them in place straight into the MarketDataQueue; a partial
+ * frame at the end of a read is moved to the front of the buffer and
+ * completed by the next read.
+ *
+ * Backpressure: the queue never drops a tick for lack of room (a pending
+ * symbol's update is overwritten), but when the number of pending symbols
+ * passes the high watermark the thread stops reading the socket until the
+ * frame loop drains it below the low watermark, so the kernel buffers fill
+ * and TCP flow control slows the server. A lost connection is retried with
+ * backoff until stop().
+ */
+class FeedIngestor {
+public:
+    /**
+     * @brief Constructor
+     * @param queue Destination queue (must outlive the ingestor)
+     */
+    explicit FeedIngestor(MarketDataQueue& queue);
+    ~FeedIngestor();
+
+    FeedIngestor(const FeedIngestor&) = delete;
+    FeedIngestor& operator=(const FeedIngestor&) = delete;
+
+    /**
+     * @brief Start the ingestion thread
+     * @return False if already running or the wake pipe could not be created
+     */
+    bool start(const FeedEndpoint& endpoint);
+
+    /**
+     * @brief Stop the thread and close the connection (blocks until joined)
+     */
+    void stop();
+
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Pending-symbol fractions of the queue capacity that pause and resume socket reads
+     */
+    void setWatermarks(float high, float low);
+
+    /**
+     * @brief Ingestion counters (readable from any thread)
+     */
+    struct Stats {
+        bool connected = false;
+        bool throttled = false;         // Reads paused by backpressure
+        uint64_t bytesReceived = 0;
+        uint64_t frames = 0;
+        uint64_t ticks = 0;
+        uint64_t rejected = 0;          // Unbound wire IDs or symbols past the queue capacity
+        uint64_t throttleEvents = 0;
+        uint64_t connects = 0;
+    };
+    Stats getStats() const;
+
+private:
+    void threadMain();
+    int connectSocket();
+    void serveConnection(int socket);
+    bool readAvailable(int socket);
+    void wake();
+
+    MarketDataQueue& queue;
+    FeedEndpoint endpoint;
+    std::thread thread;
+    std::atomic<bool> running{false};
+    int wakePipe[2] = {-1, -1};
+
+    uint32_t highWatermark = 0;
+    uint32_t lowWatermark = 0;
+
+    // Ingestion thread state
+    TickDecoder decoder;
+    std::vector<std::byte> receiveBuffer;
+    size_t receivedBytes = 0;           // Valid bytes at the front of receiveBuffer
+
+    std::atomic<bool> connected{false};
+    std::atomic<bool> throttled{false};
+    std::atomic<uint64_t> bytesReceived{0};
+    std::atomic<uint64_t> frameCount{0};
+    std::atomic<uint64_t> tickCount{0};
+    std::atomic<uint64_t> rejectedCount{0};
+    std::atomic<uint64_t> throttleCount{0};
+    std::atomic<uint64_t> connectCount{0};
+};
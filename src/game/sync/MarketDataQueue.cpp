@@ -0,0 +1,190 @@
+#include "MarketDataQueue.hpp"
+#include "src/utils/LatencyTracer.hpp"
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+MarketDataQueue::MarketDataQueue(uint32_t symbolCapacity, uint64_t windowMs_)
+    : windowMs(std::max<uint64_t>(windowMs_, 1))
+{
+    uint64_t size = std::bit_ceil(std::max<uint64_t>(symbolCapacity, 2));
+    slots = std::make_unique<Slot[]>(size);
+    cells = std::make_unique<Cell[]>(size);
+    mask = size - 1;
+
+    // Cell i is free for the producer that claims position i
+    for (uint64_t i = 0; i < size; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+uint32_t MarketDataQueue::lockSlot(Slot& slot) {
+    uint32_t state = slot.state.load(std::memory_order_relaxed);
+    for (;;) {
+        if (state & SLOT_LOCKED) {
+            std::this_thread::yield();
+            state = slot.state.load(std::memory_order_relaxed);
+        } else if (slot.state.compare_exchange_weak(state, state | SLOT_LOCKED, std::memory_order_acquire,
+                                                    std::memory_order_relaxed)) {
+            return state;
+        }
+    }
+}
+
+bool MarketDataQueue::push(const PriceUpdate& update) {
+    return push(update, update.ingestTime != 0 ? update.ingestTime : latency::now());
+}
+
+bool MarketDataQueue::push(const PriceUpdate& update, uint64_t ingestTime) {
+    if (update.symbol == INVALID_SYMBOL || update.symbol > mask) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Latest value wins: overwrite whatever the symbol had pending
+    Slot& slot = slots[update.symbol];
+    bool wasDirty = (lockSlot(slot) & SLOT_DIRTY) != 0;
+    slot.latest = update;
+    slot.latest.ingestTime = ingestTime;
+    slot.ticks = wasDirty ? slot.ticks + 1 : 1;
+    foldWindow(slot, update, !wasDirty);
+    slot.state.store(SLOT_DIRTY, std::memory_order_release);
+
+    if (!wasDirty) {
+        enqueueDirty(update.symbol);
+    }
+    pushedCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void MarketDataQueue::foldWindow(Slot& slot, const PriceUpdate& update, bool fresh) {
+    TickWindow& current = slot.current;
+    bool sameWindow = !fresh && update.timestamp / windowMs <= current.timestamp / windowMs;
+    if (sameWindow) {
+        current.ticks++;
+        current.timestamp = std::max(current.timestamp, update.timestamp);
+        current.high = std::max(current.high, update.price);
+        current.low = std::min(current.low, update.price);
+        current.close = update.price;
+        current.volume += update.volume;
+        return;
+    }
+
+    if (fresh) {
+        slot.closedCount = 0;
+    } else {
+        // Close the current window; a full slot merges its two oldest
+        if (slot.closedCount == CLOSED_WINDOWS) {
+            TickWindow& older = slot.closed[0];
+            TickWindow& newer = slot.closed[1];
+            newer.ticks += older.ticks;
+            newer.open = older.open;
+            newer.high = std::max(newer.high, older.high);
+            newer.low = std::min(newer.low, older.low);
+            newer.volume += older.volume;
+            std::copy(slot.closed + 1, slot.closed + CLOSED_WINDOWS, slot.closed);
+            --slot.closedCount;
+            mergedWindowCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        slot.closed[slot.closedCount++] = current;
+    }
+
+    current.symbol = update.symbol;
+    current.ticks = 1;
+    current.timestamp = update.timestamp;
+    current.open = current.high = current.low = current.close = update.price;
+    current.volume = update.volume;
+}
+
+void MarketDataQueue::enqueueDirty(SymbolId symbol) {
+    // A symbol is queued at most once, so a free cell always exists
+    uint64_t position = tail.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[position & mask];
+        uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence == position) {
+            // Cell is free for this position; claim it
+            if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.symbol = symbol;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return;
+            }
+            // CAS failure reloaded position; retry
+        } else {
+            // Another producer claimed this position; catch up
+            position = tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+size_t MarketDataQueue::pushBatch(const PriceUpdateBatch& updates) {
+    const uint64_t ingestTime = latency::now();
+    size_t accepted = 0;
+    for (const auto& update : updates) {
+        accepted += push(update, update.ingestTime != 0 ? update.ingestTime : ingestTime) ? 1 : 0;
+    }
+    return accepted;
+}
+
+void MarketDataQueue::drain(PriceUpdateBatch& out) {
+    drainSlots(out, nullptr);
+}
+
+void MarketDataQueue::drain(PriceUpdateBatch& out, std::vector<TickWindow>& windows) {
+    windows.clear();
+    drainSlots(out, &windows);
+}
+
+void MarketDataQueue::drainSlots(PriceUpdateBatch& out, std::vector<TickWindow>* windows) {
+    out.clear();
+
+    const uint64_t capacity = mask + 1;
+    uint64_t position = head.load(std::memory_order_relaxed);
+    const uint64_t end = tail.load(std::memory_order_acquire);
+
+    while (position != end) {
+        Cell& cell = cells[position & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;  // Next cell not published yet
+        }
+        SymbolId symbol = cell.symbol;
+
+        // Hand the cell back before clearing the slot: a producer that
+        // re-dirties the symbol then always finds a free cell
+        cell.sequence.store(position + capacity, std::memory_order_release);
+        ++position;
+
+        Slot& slot = slots[symbol];
+        lockSlot(slot);
+        out.push_back(slot.latest);
+        if (windows) {
+            windows->insert(windows->end(), slot.closed, slot.closed + slot.closedCount);
+            windows->push_back(slot.current);
+        }
+        coalescedCount += slot.ticks - 1;
+        slot.ticks = 0;
+        slot.state.store(0, std::memory_order_release);
+    }
+    head.store(position, std::memory_order_relaxed);
+
+    drainedCount += out.size();
+    lastDrainSymbols = static_cast<uint32_t>(out.size());
+}
+
+uint32_t MarketDataQueue::getDepth() const {
+    uint64_t tailPosition = tail.load(std::memory_order_relaxed);
+    uint64_t headPosition = head.load(std::memory_order_relaxed);
+    return tailPosition > headPosition ? static_cast<uint32_t>(tailPosition - headPosition) : 0;
+}
+
+MarketDataQueue::Stats MarketDataQueue::getStats() const {
+    Stats stats;
+    stats.pushed = pushedCount.load(std::memory_order_relaxed);
+    stats.dropped = droppedCount.load(std::memory_order_relaxed);
+    stats.mergedWindows = mergedWindowCount.load(std::memory_order_relaxed);
+    stats.coalesced = coalescedCount;
+    stats.drained = drainedCount;
+    stats.depth = getDepth();
+    stats.lastDrainSymbols = lastDrainSymbols;
+    return stats;
+}
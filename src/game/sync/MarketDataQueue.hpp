@@ -0,0 +1,174 @@
+#pragma once
+
+#include "PriceUpdate.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Hand-off of price updates from feed threads to the frame loop, conflated per symbol
+ *
+ * Producers (any number of feed threads) write each update into its
+ * symbol's "latest value" slot, overwriting whatever that symbol had
+ * pending, so a burst never loses a symbol's final price. The first update
+ * that makes a slot pending also appends the symbol to a lock-free ring of
+ * dirty symbols (one CAS on the tail, published with a release store). A
+ * symbol is in that ring at most once, so a ring as large as the slot table
+ * can never fill.
+ *
+ * The single consumer (the frame loop) drains the dirty ring: each entry
+ * yields its slot's latest update, in first-dirtied order, so the drained
+ * batch holds at most one update per symbol and drain() costs O(changed
+ * symbols), not O(messages).
+ *
+ * Each slot also folds its ticks into OHLC + volume windows aligned to
+ * windowMs (match it to the finest candle width). drain() can hand those
+ * over too, so candle history sees every tick. A slot keeps the current
+ * window and up to CLOSED_WINDOWS finished ones; a symbol whose ticks span
+ * more windows between two drains has its oldest windows merged.
+ *
+ * A slot is guarded by a one-word spin lock held for a handful of stores;
+ * producers only wait on each other while updating the same symbol.
+ */
+class MarketDataQueue {
+public:
+    static constexpr uint32_t CLOSED_WINDOWS = 2;
+
+    /**
+     * @brief Constructor
+     * @param symbolCapacity Symbols the queue can hold (SymbolIds below it; rounded up to a power of two)
+     * @param windowMs Width of the tick windows (milliseconds of tick time)
+     */
+    explicit MarketDataQueue(uint32_t symbolCapacity = 1u << 16, uint64_t windowMs = 1000);
+
+    // Non-copyable (owns atomics shared with producer threads)
+    MarketDataQueue(const MarketDataQueue&) = delete;
+    MarketDataQueue& operator=(const MarketDataQueue&) = delete;
+
+    /**
+     * @brief Enqueue an update (any thread, lock-free)
+     * @param update Price update with an interned symbol
+     * @return False if the symbol is invalid or past the symbol capacity (the update is dropped)
+     *
+     * An update without an ingestTime is stamped with latency::now().
+     */
+    bool push(const PriceUpdate& update);
+
+    /**
+     * @brief Enqueue an update stamped with a caller-supplied ingest time
+     *
+     * Lets a producer read the clock once per received buffer instead of per tick.
+     */
+    bool push(const PriceUpdate& update, uint64_t ingestTime);
+
+    /**
+     * @brief Enqueue a batch of updates (any thread), stamped with one ingest time
+     * @return Number of updates accepted
+     */
+    size_t pushBatch(const PriceUpdateBatch& updates);
+
+    /**
+     * @brief Drain pending updates, conflated to one per symbol (consumer thread only)
+     *
+     * Takes only the symbols dirtied before the call, so a producer that
+     * never pauses cannot stall the frame.
+     *
+     * @param out Receives the latest update of each changed symbol (cleared first)
+     */
+    void drain(PriceUpdateBatch& out);
+
+    /**
+     * @brief Drain as above, plus every pending tick window
+     * @param windows Receives each changed symbol's windows, oldest first (cleared first)
+     */
+    void drain(PriceUpdateBatch& out, std::vector<TickWindow>& windows);
+
+    /**
+     * @brief Approximate number of symbols with a pending update
+     */
+    uint32_t getDepth() const;
+
+    /**
+     * @brief Symbol capacity (the most updates that can be pending at once)
+     */
+    uint32_t getCapacity() const { return static_cast<uint32_t>(mask + 1); }
+
+    /**
+     * @brief Ingestion counters (cumulative except lastDrainSymbols; consumer thread)
+     */
+    struct Stats {
+        uint64_t pushed = 0;            // Accepted by push()
+        uint64_t dropped = 0;           // Rejected: invalid symbol or past the symbol capacity
+        uint64_t coalesced = 0;         // Superseded by a newer update of the same symbol
+        uint64_t drained = 0;           // Delivered to the frame loop
+        uint64_t mergedWindows = 0;     // Tick windows merged into a later one (slot full)
+        uint32_t depth = 0;             // Symbols with a pending update
+        uint32_t lastDrainSymbols = 0;  // Symbols in the last drained batch
+    };
+    Stats getStats() const;
+
+private:
+    static constexpr uint32_t SLOT_LOCKED = 1u;
+    static constexpr uint32_t SLOT_DIRTY = 2u;     // Pending: the symbol is (or is about to be) in the dirty ring
+
+    /**
+     * @brief A symbol's pending update
+     */
+    struct Slot {
+        std::atomic<uint32_t> state{0};             // SLOT_LOCKED | SLOT_DIRTY
+        uint32_t ticks = 0;                         // Updates merged since the last drain
+        uint32_t closedCount = 0;
+        PriceUpdate latest;
+        TickWindow current;
+        TickWindow closed[CLOSED_WINDOWS];          // Finished windows, oldest first
+    };
+
+    /**
+     * @brief Dirty-ring cell
+     */
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        SymbolId symbol;
+    };
+
+    /**
+     * @brief Spin until the slot's lock is taken
+     * @return Slot state before locking (SLOT_DIRTY set if an update was pending)
+     */
+    static uint32_t lockSlot(Slot& slot);
+
+    /**
+     * @brief Append a newly dirtied symbol to the ring
+     */
+    void enqueueDirty(SymbolId symbol);
+
+    /**
+     * @brief Fold an update into the slot's windows (slot locked)
+     * @param fresh The slot had nothing pending
+     */
+    void foldWindow(Slot& slot, const PriceUpdate& update, bool fresh);
+
+    /**
+     * @brief Shared drain; windows may be null
+     */
+    void drainSlots(PriceUpdateBatch& out, std::vector<TickWindow>* windows);
+
+    std::unique_ptr<Slot[]> slots;                // Indexed by SymbolId
+    std::unique_ptr<Cell[]> cells;                // Dirty ring, as large as the slot table
+    uint64_t mask;
+    uint64_t windowMs;
+
+    // Producer and consumer cursors on separate cache lines
+    alignas(64) std::atomic<uint64_t> tail{0};    // Next position to claim (producers)
+    alignas(64) std::atomic<uint64_t> head{0};    // Next position to read (consumer)
+
+    alignas(64) std::atomic<uint64_t> pushedCount{0};
+    std::atomic<uint64_t> droppedCount{0};
+    std::atomic<uint64_t> mergedWindowCount{0};
+
+    // Consumer-only state
+    uint64_t coalescedCount = 0;
+    uint64_t drainedCount = 0;
+    uint32_t lastDrainSymbols = 0;
+};
@@ -0,0 +1,243 @@
+#include "MockDataGenerator.hpp"
+#include "src/utils/Simd.hpp"
+#include "src/utils/ThreadPool.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace {
+
+constexpr uint32_t BLOCK_SIZE = 256;           // Slots per block (multiple of simd::MaxWidth)
+constexpr uint32_t PARALLEL_MIN_BLOCKS = 16;   // Below this a step runs on the calling thread
+
+// Stream constants: independent draws derived from one per-slot hash
+constexpr uint32_t STREAM_RADIUS = 0x3C6EF372u;
+constexpr uint32_t STREAM_ANGLE = 0xA54FF53Au;
+constexpr uint32_t STREAM_JUMP = 0x510E527Fu;
+constexpr uint32_t SECTOR_DOMAIN = 0x9B05688Cu;
+
+constexpr float TWO_PI = 6.28318530718f;
+constexpr float INV_2_24 = 1.0f / 16777216.0f;
+
+/**
+ * @brief 32-bit integer finalizer (lowbias32); counter -> uniform bits
+ */
+inline uint32_t hash32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+inline uint32_t slotHash(uint32_t key, uint32_t slot) {
+    return hash32(slot * 0x9E3779B9u + key);
+}
+
+/** @brief 24-bit uniform in (0, 1] (safe for log) */
+inline float uniformOpen(uint32_t bits) {
+    return static_cast<float>((bits >> 8) + 1) * INV_2_24;
+}
+
+/** @brief 24-bit uniform in [0, 1) */
+inline float uniform(uint32_t bits) {
+    return static_cast<float>(bits >> 8) * INV_2_24;
+}
+
+/**
+ * @brief Scalar Box-Muller (sector factors and the per-symbol path)
+ */
+inline float normalFromHash(uint32_t hash) {
+    float radius = std::sqrt(-2.0f * std::log(uniformOpen(hash32(hash ^ STREAM_RADIUS))));
+    return radius * std::cos(TWO_PI * uniform(hash32(hash ^ STREAM_ANGLE)));
+}
+
+/**
+ * @brief Per-block scratch: hashed counters unpacked into float lanes
+ */
+struct BlockScratch {
+    float logExponent[BLOCK_SIZE];    // Exponent of u1 (u1 = 2^e * m)
+    float logMantissa[BLOCK_SIZE];    // Mantissa of u1 in [1, 2)
+    float angle[BLOCK_SIZE];          // u2 - 0.5 in [-0.5, 0.5)
+    float spike[BLOCK_SIZE];          // Jump multiplier or 1
+    float factor[BLOCK_SIZE];         // Sector term of the symbol
+};
+
+} // anonymous namespace
+
+MockDataGenerator::MockDataGenerator(uint64_t seed_)
+    : seed(seed_)
+{
+    setSectorCorrelation(0.3f);
+    setJumps(0.05f, 5.0f);  // 5% chance of a 5x move
+}
+
+void MockDataGenerator::registerSymbol(SymbolId symbol, float basePrice, uint32_t sector) {
+    if (symbol >= slotBySymbol.size()) {
+        slotBySymbol.resize(static_cast<size_t>(symbol) + 1, INVALID_SLOT);
+    }
+    uint32_t& slot = slotBySymbol[symbol];
+    if (slot == INVALID_SLOT) {
+        slot = static_cast<uint32_t>(symbols.size());
+        symbols.push_back(symbol);
+        sectorOf.push_back(sector);
+        // Keep the price stream padded so SIMD blocks never read past the end
+        prices.resize(simd::padCount(static_cast<uint32_t>(symbols.size())), 1.0f);
+    } else {
+        sectorOf[slot] = sector;
+    }
+    prices[slot] = basePrice;
+
+    if (sector >= sectorTerms.size()) {
+        sectorTerms.resize(static_cast<size_t>(sector) + 1, 0.0f);
+    }
+}
+
+void MockDataGenerator::setSectorCorrelation(float correlation) {
+    correlation = std::clamp(correlation, 0.0f, 1.0f);
+    sectorWeight = std::sqrt(correlation);
+    idiosyncraticWeight = std::sqrt(1.0f - correlation);
+}
+
+void MockDataGenerator::setJumps(float probability, float multiplier) {
+    probability = std::clamp(probability, 0.0f, 1.0f);
+    jumpThreshold = static_cast<uint32_t>(probability * 16777216.0f);
+    jumpMultiplier = multiplier;
+}
+
+uint32_t MockDataGenerator::beginStep() {
+    uint32_t key = hash32(static_cast<uint32_t>(seed) ^ hash32(static_cast<uint32_t>(step) + static_cast<uint32_t>(seed >> 32)));
+    key = hash32(key ^ static_cast<uint32_t>(step >> 32));
+    ++step;
+
+    for (uint32_t sector = 0; sector < sectorTerms.size(); ++sector) {
+        sectorTerms[sector] = sectorWeight * normalFromHash(slotHash(key ^ SECTOR_DOMAIN, sector));
+    }
+    return key;
+}
+
+void MockDataGenerator::generateUpdates(PriceUpdateBatch& out) {
+    const uint32_t count = static_cast<uint32_t>(symbols.size());
+    out.resize(count);
+    if (count == 0) {
+        return;
+    }
+
+    const uint32_t key = beginStep();
+    const uint32_t blockCount = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    auto runBlocks = [&](uint32_t, uint32_t beginBlock, uint32_t endBlock) {
+        uint32_t begin = beginBlock * BLOCK_SIZE;
+        uint32_t end = std::min(endBlock * BLOCK_SIZE, count);
+        stepRange(key, begin, end);
+
+        for (uint32_t slot = begin; slot < end; ++slot) {
+            PriceUpdate& update = out[slot];
+            update.symbol = symbols[slot];
+            update.price = prices[slot];
+            update.volume = 0.0f;
+            update.timestamp = 0;
+        }
+    };
+
+    ThreadPool& pool = ThreadPool::shared();
+    if (blockCount >= PARALLEL_MIN_BLOCKS && pool.getConcurrency() > 1) {
+        pool.parallelFor(blockCount, pool.getConcurrency() * 4, runBlocks);
+    } else {
+        runBlocks(0, 0, blockCount);
+    }
+}
+
+void MockDataGenerator::stepRange(uint32_t key, uint32_t begin, uint32_t end) {
+    BlockScratch scratch;
+
+    const simd::Float ln2(0.69314718f);
+    const simd::Float one(1.0f);
+    const simd::Float two(2.0f);
+    const simd::Float minusTwo(-2.0f);
+    const simd::Float zero(0.0f);
+    const simd::Float pi(3.14159265f);
+    const simd::Float minPrice(1.0f);
+    const simd::Float vol(volatility);
+    const simd::Float idiosyncratic(idiosyncraticWeight);
+
+    for (uint32_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE) {
+        const uint32_t n = std::min(BLOCK_SIZE, end - blockBegin);
+        const uint32_t padded = simd::padCount(n);
+
+        // 1. Counter hashing and bit unpacking (branch-free integer loop)
+        for (uint32_t i = 0; i < padded; ++i) {
+            uint32_t hash = slotHash(key, blockBegin + i);
+            uint32_t bits = std::bit_cast<uint32_t>(uniformOpen(hash32(hash ^ STREAM_RADIUS)));
+            scratch.logExponent[i] = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+            scratch.logMantissa[i] = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u);
+            scratch.angle[i] = uniform(hash32(hash ^ STREAM_ANGLE)) - 0.5f;
+            scratch.spike[i] = ((hash32(hash ^ STREAM_JUMP) >> 8) < jumpThreshold) ? jumpMultiplier : 1.0f;
+        }
+
+        // 2. Sector factor gather
+        for (uint32_t i = 0; i < n; ++i) {
+            scratch.factor[i] = sectorTerms[sectorOf[blockBegin + i]];
+        }
+        std::fill(scratch.factor + n, scratch.factor + padded, 0.0f);
+
+        // 3. Box-Muller and price step on SIMD lanes
+        float* price = prices.data() + blockBegin;
+        for (uint32_t i = 0; i < padded; i += simd::Float::Width) {
+            // ln(u1) = e*ln2 + ln(m), ln(m) = 2 atanh(t) with t = (m-1)/(m+1) in [0, 1/3)
+            simd::Float m = simd::Float::load(scratch.logMantissa + i);
+            simd::Float t = (m - one) / (m + one);
+            simd::Float t2 = t * t;
+            simd::Float series = fma(t2, fma(t2, fma(t2, simd::Float(1.0f / 7.0f), simd::Float(1.0f / 5.0f)),
+                                             simd::Float(1.0f / 3.0f)), one);
+            simd::Float logU1 = fma(simd::Float::load(scratch.logExponent + i), ln2, two * t * series);
+            simd::Float radius = sqrt(max(minusTwo * logU1, zero));
+
+            // cos(2*pi*u2) = 2 sin^2(pi*(u2 - 0.5)) - 1, sin by odd Taylor series on [-pi/2, pi/2]
+            simd::Float theta = pi * simd::Float::load(scratch.angle + i);
+            simd::Float theta2 = theta * theta;
+            simd::Float sine = theta * fma(theta2,
+                fma(theta2, fma(theta2, fma(theta2, simd::Float(1.0f / 362880.0f), simd::Float(-1.0f / 5040.0f)),
+                                simd::Float(1.0f / 120.0f)),
+                    simd::Float(-1.0f / 6.0f)),
+                one);
+            simd::Float normal = radius * fma(two * sine, sine, simd::Float(-1.0f));
+
+            // Geometric step: sector factor plus idiosyncratic noise, scaled by any jump
+            simd::Float move = fma(idiosyncratic, normal, simd::Float::load(scratch.factor + i));
+            simd::Float change = vol * simd::Float::load(scratch.spike + i) * move;
+            simd::Float p = simd::Float::load(price + i);
+            max(p * (one + change), minPrice).store(price + i);
+        }
+    }
+}
+
+PriceUpdateBatch MockDataGenerator::generateUpdatesFor(const std::vector<SymbolId>& tickers) {
+    PriceUpdateBatch updates;
+    updates.reserve(tickers.size());
+
+    const uint32_t key = beginStep();
+    for (SymbolId symbol : tickers) {
+        uint32_t slot = findSlot(symbol);
+        if (slot == INVALID_SLOT) {
+            continue;
+        }
+
+        uint32_t hash = slotHash(key, slot);
+        float spike = ((hash32(hash ^ STREAM_JUMP) >> 8) < jumpThreshold) ? jumpMultiplier : 1.0f;
+        float move = sectorTerms[sectorOf[slot]] + idiosyncraticWeight * normalFromHash(hash);
+
+        float& price = prices[slot];
+        price = std::max(price * (1.0f + volatility * spike * move), 1.0f);
+
+        PriceUpdate update;
+        update.symbol = symbol;
+        update.price = price;
+        update.timestamp = 0;
+
+        updates.push_back(update);
+    }
+
+    return updates;
+}
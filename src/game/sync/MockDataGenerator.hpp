@@ -3,40 +3,52 @@
 #include "PriceUpdate.hpp"
 #include <vector>
 #include <string>
-#include <random>
-#include <unordered_map>
+#include <cstdint>
 
 /**
  * @brief Mock data generator for testing without live API
  *
  * Generates realistic price fluctuations for testing:
- * - Random walk price movements
- * - Occasional spikes (surge/crash events)
+ * - Geometric random walk per symbol
+ * - Correlated sector moves (one shared factor per sector per step)
+ * - Occasional spikes (jump events that multiply the move)
  * - Configurable volatility
+ *
+ * Deterministic: every random number is a hash of (seed, step, symbol
+ * slot, stream), so a seed reproduces the same price paths regardless of
+ * batch size or thread count. Prices live in a padded SoA array; a step
+ * hashes counters in blocks, turns them into normals with a polynomial
+ * Box-Muller transform on simd::Float lanes, and splits large universes
+ * across ThreadPool::shared().
  */
 class MockDataGenerator {
 public:
+    static constexpr uint64_t DEFAULT_SEED = 0x4D494E49454E47ull;
+
     /**
      * @brief Constructor
+     * @param seed Seed for the price paths
      */
-    MockDataGenerator()
-        : rng(std::random_device{}())
-        , normalDist(0.0f, 1.0f)
-        , basePrices()
-        , updateInterval(1.0f)
-        , volatility(0.02f)  // 2% volatility per update
-    {
-    }
+    explicit MockDataGenerator(uint64_t seed = DEFAULT_SEED);
 
     /**
      * @brief Register a ticker with base price
      * @param ticker Ticker symbol
      * @param basePrice Base price
+     * @param sector Sector index for correlated moves
      */
-    void registerTicker(const std::string& ticker, float basePrice) {
-        basePrices[ticker] = basePrice;
+    void registerTicker(const std::string& ticker, float basePrice, uint32_t sector = 0) {
+        registerSymbol(SymbolTable::global().intern(ticker), basePrice, sector);
     }
 
+    /**
+     * @brief Register an already interned symbol with base price
+     * @param symbol Symbol ID
+     * @param basePrice Base price (replaces the current price if already registered)
+     * @param sector Sector index for correlated moves
+     */
+    void registerSymbol(SymbolId symbol, float basePrice, uint32_t sector = 0);
+
     /**
      * @brief Register multiple tickers
      * @param tickers Vector of ticker symbols
@@ -48,78 +60,39 @@ public:
         }
     }
 
+    /**
+     * @brief Advance every registered symbol one step into a caller-owned batch
+     *
+     * The batch is resized to getTickerCount(); it does not allocate once
+     * its capacity covers the universe.
+     *
+     * @param out Receives one update per symbol, in registration order
+     */
+    void generateUpdates(PriceUpdateBatch& out);
+
     /**
      * @brief Generate mock price updates for all registered tickers
      * @return Vector of price updates
      */
     PriceUpdateBatch generateUpdates() {
         PriceUpdateBatch updates;
-
-        for (auto& pair : basePrices) {
-            const std::string& ticker = pair.first;
-            float& price = pair.second;
-
-            // Random walk with drift
-            float change = normalDist(rng) * volatility;
-
-            // Occasional spikes (5% chance)
-            if (std::uniform_real_distribution<float>(0.0f, 1.0f)(rng) < 0.05f) {
-                change *= 5.0f;  // 5x volatility for spike
-            }
-
-            // Apply change
-            price *= (1.0f + change);
-
-            // Clamp to reasonable range (prevent negative prices)
-            if (price < 1.0f) {
-                price = 1.0f;
-            }
-
-            // Create update
-            PriceUpdate update;
-            update.ticker = ticker;
-            update.price = price;
-            update.timestamp = 0;  // TODO: Add timestamp
-
-            updates.push_back(update);
-        }
-
+        generateUpdates(updates);
         return updates;
     }
 
     /**
-     * @brief Generate updates for specific tickers
-     * @param tickers Vector of tickers to update
+     * @brief Generate updates for specific symbols
+     * @param tickers Vector of symbol IDs to update
      * @return Vector of price updates
      */
-    PriceUpdateBatch generateUpdatesFor(const std::vector<std::string>& tickers) {
-        PriceUpdateBatch updates;
-
-        for (const auto& ticker : tickers) {
-            auto it = basePrices.find(ticker);
-            if (it == basePrices.end()) {
-                continue;
-            }
-
-            float& price = it->second;
-
-            // Random walk
-            float change = normalDist(rng) * volatility;
-            price *= (1.0f + change);
-
-            if (price < 1.0f) {
-                price = 1.0f;
-            }
+    PriceUpdateBatch generateUpdatesFor(const std::vector<SymbolId>& tickers);
 
-            PriceUpdate update;
-            update.ticker = ticker;
-            update.price = price;
-            update.timestamp = 0;
-
-            updates.push_back(update);
-        }
-
-        return updates;
+    /**
+     * @brief Restart the price paths from a new seed (prices keep their current values)
+     */
+    void setSeed(uint64_t newSeed) {
+        seed = newSeed;
+        step = 0;
     }
 
     /**
@@ -130,17 +103,36 @@ public:
         volatility = vol;
     }
 
+    /**
+     * @brief Share of each move explained by the sector factor
+     * @param correlation Pairwise correlation of symbols in one sector [0, 1]
+     */
+    void setSectorCorrelation(float correlation);
+
+    /**
+     * @brief Configure jump events
+     * @param probability Chance per symbol per step
+     * @param multiplier Factor applied to the move when a jump occurs
+     */
+    void setJumps(float probability, float multiplier);
+
     /**
      * @brief Get current price for a ticker
      * @param ticker Ticker symbol
      * @return Current price (0.0 if not found)
      */
     float getCurrentPrice(const std::string& ticker) const {
-        auto it = basePrices.find(ticker);
-        if (it != basePrices.end()) {
-            return it->second;
-        }
-        return 0.0f;
+        return getCurrentPrice(SymbolTable::global().find(ticker));
+    }
+
+    /**
+     * @brief Get current price for a symbol
+     * @param symbol Symbol ID
+     * @return Current price (0.0 if not registered)
+     */
+    float getCurrentPrice(SymbolId symbol) const {
+        uint32_t slot = findSlot(symbol);
+        return slot != INVALID_SLOT ? prices[slot] : 0.0f;
     }
 
     /**
@@ -148,14 +140,38 @@ public:
      * @return Ticker count
      */
     size_t getTickerCount() const {
-        return basePrices.size();
+        return symbols.size();
     }
 
 private:
-    std::mt19937 rng;
-    std::normal_distribution<float> normalDist;
-    std::unordered_map<std::string, float> basePrices;  // ticker -> current price
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+
+    uint32_t findSlot(SymbolId symbol) const {
+        return symbol < slotBySymbol.size() ? slotBySymbol[symbol] : INVALID_SLOT;
+    }
+
+    /**
+     * @brief Start a step: derive its key and draw the sector factors
+     */
+    uint32_t beginStep();
 
-    float updateInterval;
-    float volatility;
+    /**
+     * @brief Advance slots [begin, end) (begin is a multiple of the block size)
+     */
+    void stepRange(uint32_t key, uint32_t begin, uint32_t end);
+
+    uint64_t seed;
+    uint64_t step = 0;
+
+    std::vector<SymbolId> symbols;        // Registered symbols, registration order
+    std::vector<float> prices;            // Current price, parallel to symbols (padded to simd::MaxWidth)
+    std::vector<uint32_t> sectorOf;       // Sector index, parallel to symbols
+    std::vector<uint32_t> slotBySymbol;   // SymbolId -> index into symbols/prices
+    std::vector<float> sectorTerms;       // This step's correlated move per sector
+
+    float volatility = 0.02f;             // 2% volatility per update
+    float sectorWeight = 0.0f;            // sqrt(correlation)
+    float idiosyncraticWeight = 1.0f;     // sqrt(1 - correlation)
+    uint32_t jumpThreshold = 0;           // Jump when a 24-bit uniform falls below this
+    float jumpMultiplier = 5.0f;
 };
@@ -0,0 +1,209 @@
+#include "PriceHistory.hpp"
+#include "src/utils/Logger.hpp"
+#include <algorithm>
+
+PriceHistory::PriceHistory(const PriceHistoryConfig& config) {
+    size_t bytesPerSeries = 0;
+    for (size_t r = 0; r < RESOLUTION_COUNT; ++r) {
+        rings[r].capacity = std::max<uint32_t>(config.bucketCount[r], 1);
+        rings[r].widthMs = bucketWidthMs(static_cast<HistoryResolution>(r));
+        bytesPerSeries += rings[r].capacity * bytesPerCandle() + 2 * sizeof(uint32_t);
+    }
+    maxSeries = static_cast<uint32_t>(std::min<size_t>(config.memoryBudget / bytesPerSeries, INVALID_SERIES - 1));
+
+    LOG_INFO("PriceHistory") << "Budget " << (config.memoryBudget >> 10) << " KB: up to " << maxSeries
+                             << " symbols at " << bytesPerSeries << " bytes each";
+}
+
+uint32_t PriceHistory::acquireSeries(SymbolId symbol) {
+    if (symbol < seriesOfSymbol.size() && seriesOfSymbol[symbol] != INVALID_SERIES) {
+        return seriesOfSymbol[symbol];
+    }
+    if (symbol == INVALID_SYMBOL) {
+        return INVALID_SERIES;
+    }
+    if (seriesCount >= maxSeries) {
+        if (untrackedCount++ == 0) {
+            LOG_WARN("PriceHistory") << "Memory budget reached at " << maxSeries << " symbols; "
+                                     << "further symbols have no history";
+        }
+        return INVALID_SERIES;
+    }
+
+    // Grow in steps with exact reservations so storage never passes the budget
+    uint32_t series = seriesCount++;
+    for (Ring& ring : rings) {
+        if (series >= ring.newest.capacity()) {
+            size_t reserveSeries = std::min<size_t>(static_cast<size_t>(series) + SERIES_GROWTH, maxSeries);
+            size_t reserveCandles = reserveSeries * ring.capacity;
+            ring.forEachColumn([reserveCandles](auto& column) { column.reserve(reserveCandles); });
+            ring.newest.reserve(reserveSeries);
+            ring.count.reserve(reserveSeries);
+        }
+
+        size_t candles = static_cast<size_t>(seriesCount) * ring.capacity;
+        ring.forEachColumn([candles](auto& column) { column.resize(candles); });
+        ring.newest.push_back(0);
+        ring.count.push_back(0);
+    }
+
+    if (symbol >= seriesOfSymbol.size()) {
+        seriesOfSymbol.resize(static_cast<size_t>(symbol) + 1, INVALID_SERIES);
+    }
+    seriesOfSymbol[symbol] = series;
+    return series;
+}
+
+bool PriceHistory::fold(uint32_t series, uint64_t timestamp, float open, float high, float low, float close,
+                        float volume) {
+    // The finest resolution has the latest newest-candle start: anything at
+    // or after it is current for every resolution
+    const Ring& finest = rings[0];
+    if (finest.count[series] > 0) {
+        size_t newest = static_cast<size_t>(series) * finest.capacity + finest.newest[series];
+        if (timestamp < finest.start[newest]) {
+            return false;
+        }
+    }
+
+    for (Ring& ring : rings) {
+        uint64_t bucket = timestamp - timestamp % ring.widthMs;
+        size_t base = static_cast<size_t>(series) * ring.capacity;
+        uint32_t& newest = ring.newest[series];
+        uint32_t& count = ring.count[series];
+
+        size_t slot = base + newest;
+        if (count > 0 && ring.start[slot] == bucket) {
+            // Same bucket: roll the range into the open candle
+            ring.high[slot] = std::max(ring.high[slot], high);
+            ring.low[slot] = std::min(ring.low[slot], low);
+            ring.close[slot] = close;
+            ring.volume[slot] += volume;
+            continue;
+        }
+
+        // New bucket: open a candle, overwriting the oldest once the ring is full
+        if (count > 0) {
+            newest = newest + 1 == ring.capacity ? 0 : newest + 1;
+            slot = base + newest;
+        }
+        count = std::min(count + 1, ring.capacity);
+        ring.start[slot] = bucket;
+        ring.open[slot] = open;
+        ring.high[slot] = high;
+        ring.low[slot] = low;
+        ring.close[slot] = close;
+        ring.volume[slot] = volume;
+    }
+    return true;
+}
+
+void PriceHistory::record(SymbolId symbol, float price, float volume, uint64_t timestamp) {
+    uint32_t series = acquireSeries(symbol);
+    if (series == INVALID_SERIES) {
+        return;
+    }
+
+    if (fold(series, timestamp, price, price, price, price, volume)) {
+        ++recordedCount;
+    } else {
+        ++lateCount;
+    }
+}
+
+void PriceHistory::record(const PriceUpdateBatch& updates, uint64_t fallbackTimestamp) {
+    for (const auto& update : updates) {
+        record(update.symbol, update.price, update.volume,
+               update.timestamp != 0 ? update.timestamp : fallbackTimestamp);
+    }
+}
+
+void PriceHistory::record(std::span<const TickWindow> windows, uint64_t fallbackTimestamp) {
+    for (const TickWindow& window : windows) {
+        uint32_t series = acquireSeries(window.symbol);
+        if (series == INVALID_SERIES) {
+            continue;
+        }
+
+        uint64_t timestamp = window.timestamp != 0 ? window.timestamp : fallbackTimestamp;
+        if (fold(series, timestamp, window.open, window.high, window.low, window.close, window.volume)) {
+            recordedCount += window.ticks;
+        } else {
+            lateCount += window.ticks;
+        }
+    }
+}
+
+void PriceHistory::clear() {
+    for (Ring& ring : rings) {
+        std::fill(ring.newest.begin(), ring.newest.end(), 0);
+        std::fill(ring.count.begin(), ring.count.end(), 0);
+    }
+}
+
+size_t PriceHistory::getCandles(SymbolId symbol, HistoryResolution resolution, std::span<Candle> out) const {
+    if (!contains(symbol)) {
+        return 0;
+    }
+
+    const Ring& ring = rings[static_cast<size_t>(resolution)];
+    uint32_t series = seriesOfSymbol[symbol];
+    size_t base = static_cast<size_t>(series) * ring.capacity;
+    uint32_t written = static_cast<uint32_t>(std::min<size_t>(ring.count[series], out.size()));
+    if (written == 0) {
+        return 0;
+    }
+
+    // Oldest of the candles written is written - 1 slots before the newest
+    uint32_t slot = (ring.newest[series] + ring.capacity - (written - 1)) % ring.capacity;
+    for (uint32_t k = 0; k < written; ++k) {
+        size_t i = base + slot;
+        out[k] = Candle{ring.start[i], ring.open[i], ring.high[i], ring.low[i], ring.close[i], ring.volume[i]};
+        slot = slot + 1 == ring.capacity ? 0 : slot + 1;
+    }
+    return written;
+}
+
+size_t PriceHistory::packSeries(std::span<const SymbolId> symbols, HistoryResolution resolution,
+                                uint64_t referenceTime, std::span<rendering::CandleData> out) const {
+    const Ring& ring = rings[static_cast<size_t>(resolution)];
+    const size_t rowCount = std::min(symbols.size(), out.size() / ring.capacity);
+
+    for (size_t row = 0; row < rowCount; ++row) {
+        std::span<rendering::CandleData> dst = out.subspan(row * ring.capacity, ring.capacity);
+        SymbolId symbol = symbols[row];
+        uint32_t count = contains(symbol) ? ring.count[seriesOfSymbol[symbol]] : 0;
+
+        // Empty columns on the left
+        std::fill(dst.begin(), dst.end() - count, rendering::CandleData{glm::vec4(0.0f), glm::vec4(0.0f)});
+        if (count == 0) {
+            continue;
+        }
+
+        uint32_t series = seriesOfSymbol[symbol];
+        size_t base = static_cast<size_t>(series) * ring.capacity;
+        uint32_t slot = (ring.newest[series] + ring.capacity - (count - 1)) % ring.capacity;
+        for (uint32_t k = ring.capacity - count; k < ring.capacity; ++k) {
+            size_t i = base + slot;
+            float seconds = static_cast<float>(static_cast<int64_t>(ring.start[i] - referenceTime)) * 0.001f;
+            dst[k].ohlc = glm::vec4(ring.open[i], ring.high[i], ring.low[i], ring.close[i]);
+            dst[k].timeVolume = glm::vec4(seconds, ring.volume[i], 1.0f, 0.0f);
+            slot = slot + 1 == ring.capacity ? 0 : slot + 1;
+        }
+    }
+    return rowCount;
+}
+
+PriceHistory::Stats PriceHistory::getStats() const {
+    Stats stats;
+    stats.series = seriesCount;
+    stats.maxSeries = maxSeries;
+    for (const Ring& ring : rings) {
+        stats.memoryBytes += ring.start.capacity() * bytesPerCandle()
+                           + (ring.newest.capacity() + ring.count.capacity()) * sizeof(uint32_t);
+    }
+    stats.recorded = recordedCount;
+    stats.late = lateCount;
+    stats.untracked = untrackedCount;
+    return stats;
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "PriceUpdate.hpp"
+#include "src/rendering/InstancedRenderData.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Bucket width of a price history series
+ */
+enum class HistoryResolution : uint32_t {
+    Second,         // 1 s candles
+    Minute,         // 1 min candles
+    FiveMinutes,    // 5 min candles
+    Count
+};
+
+/**
+ * @brief Sizing of a PriceHistory
+ */
+struct PriceHistoryConfig {
+    // Candles kept per symbol at each resolution (2 min, 2 h, 24 h by default)
+    std::array<uint32_t, static_cast<size_t>(HistoryResolution::Count)> bucketCount{120, 120, 288};
+
+    // Hard cap on candle storage; symbols past it are not tracked
+    size_t memoryBudget = 64u << 20;
+};
+
+/**
+ * @brief Fixed-memory OHLC + volume history of every symbol, at several resolutions
+ *
+ * Each resolution stores its candles column by column (start, open, high,
+ * low, close, volume), one fixed-size ring per symbol at [series * capacity,
+ * (series + 1) * capacity). An update folds into the newest candle of every
+ * resolution, or opens a new one that overwrites the oldest, so ingest is
+ * O(resolutions) and never allocates once a symbol has its rings.
+ *
+ * Series are allocated on a symbol's first update until the memory budget is
+ * reached; later symbols are counted in getStats().untracked and ignored.
+ * Updates older than a symbol's newest candle are dropped (counted in
+ * getStats().late); clear() restarts history after a replay seek.
+ *
+ * The frame loop records the queue's TickWindows rather than its conflated
+ * updates (latest per symbol per frame): windows are 1 s wide, so each
+ * folds into exactly one candle per resolution with the open, extremes and
+ * full volume of every tick it covers.
+ */
+class PriceHistory {
+public:
+    static constexpr size_t RESOLUTION_COUNT = static_cast<size_t>(HistoryResolution::Count);
+
+    /**
+     * @brief One candle, as read back by getCandles()
+     */
+    struct Candle {
+        uint64_t start = 0;         // Bucket start (milliseconds since epoch)
+        float open = 0.0f;
+        float high = 0.0f;
+        float low = 0.0f;
+        float close = 0.0f;
+        float volume = 0.0f;
+    };
+
+    explicit PriceHistory(const PriceHistoryConfig& config = {});
+
+    /**
+     * @brief Bucket width of a resolution in milliseconds
+     */
+    static constexpr uint64_t bucketWidthMs(HistoryResolution resolution) {
+        constexpr uint64_t widths[RESOLUTION_COUNT] = {1000, 60 * 1000, 5 * 60 * 1000};
+        return widths[static_cast<size_t>(resolution)];
+    }
+
+    /**
+     * @brief Fold one update into every resolution
+     * @param symbol Interned ticker
+     * @param price Trade price
+     * @param volume Traded volume (0 if not reported)
+     * @param timestamp Milliseconds since epoch
+     */
+    void record(SymbolId symbol, float price, float volume, uint64_t timestamp);
+
+    /**
+     * @brief Fold a batch of updates (updates without a timestamp use fallbackTimestamp)
+     */
+    void record(const PriceUpdateBatch& updates, uint64_t fallbackTimestamp);
+
+    /**
+     * @brief Fold MarketDataQueue tick windows (each lies within one 1 s bucket)
+     *
+     * Windows without a timestamp use fallbackTimestamp.
+     */
+    void record(std::span<const TickWindow> windows, uint64_t fallbackTimestamp);
+
+    /**
+     * @brief Forget all candles (series allocations are kept)
+     */
+    void clear();
+
+    bool contains(SymbolId symbol) const {
+        return symbol < seriesOfSymbol.size() && seriesOfSymbol[symbol] != INVALID_SERIES;
+    }
+
+    /**
+     * @brief Candles kept per symbol at a resolution
+     */
+    uint32_t getCapacity(HistoryResolution resolution) const {
+        return rings[static_cast<size_t>(resolution)].capacity;
+    }
+
+    /**
+     * @brief Copy a symbol's candles, oldest first
+     * @param out Receives the newest min(count, out.size()) candles
+     * @return Number of candles written
+     */
+    size_t getCandles(SymbolId symbol, HistoryResolution resolution, std::span<Candle> out) const;
+
+    /**
+     * @brief Pack several symbols' series into one GPU-ready array
+     * @param symbols Series to pack, one row each (e.g. a sector's buildings)
+     * @param referenceTime Time the packed timestamps are relative to (milliseconds since epoch)
+     * @param out symbols.size() * getCapacity(resolution) elements, row-major
+     * @return Number of rows written (stops early if out is too small)
+     *
+     * Rows are right-aligned: column capacity - 1 holds the newest candle and
+     * unused columns are zero (timeVolume.z = 0). Untracked symbols get
+     * empty rows. The result maps directly onto an SSBO or an RGBA32F
+     * texture of 2 * capacity texels per row.
+     */
+    size_t packSeries(std::span<const SymbolId> symbols, HistoryResolution resolution,
+                      uint64_t referenceTime, std::span<rendering::CandleData> out) const;
+
+    /**
+     * @brief Ingest and memory counters
+     */
+    struct Stats {
+        size_t series = 0;          // Symbols with allocated rings
+        size_t maxSeries = 0;       // Series the memory budget allows
+        size_t memoryBytes = 0;     // Reserved candle storage
+        uint64_t recorded = 0;      // Ticks folded in (a window counts all of its ticks)
+        uint64_t late = 0;          // Ticks dropped: older than the symbol's newest candle
+        uint64_t untracked = 0;     // Dropped: symbol past the memory budget
+    };
+    Stats getStats() const;
+
+private:
+    static constexpr uint32_t INVALID_SERIES = 0xFFFFFFFFu;
+    static constexpr uint32_t SERIES_GROWTH = 256;  // Series added per storage growth step
+
+    /**
+     * @brief Candle columns of one resolution
+     */
+    struct Ring {
+        uint32_t capacity = 0;
+        uint64_t widthMs = 0;
+        std::vector<uint64_t> start;
+        std::vector<float> open;
+        std::vector<float> high;
+        std::vector<float> low;
+        std::vector<float> close;
+        std::vector<float> volume;
+        std::vector<uint32_t> newest;       // Per series: slot of the newest candle
+        std::vector<uint32_t> count;        // Per series: candles held
+
+        template<typename Fn>
+        void forEachColumn(Fn&& fn) {
+            fn(start);
+            fn(open);
+            fn(high);
+            fn(low);
+            fn(close);
+            fn(volume);
+        }
+    };
+
+    /**
+     * @brief Fold a price range into the current candle of every resolution
+     * @return False if the time is older than the series' newest candle
+     */
+    bool fold(uint32_t series, uint64_t timestamp, float open, float high, float low, float close, float volume);
+
+    /**
+     * @brief Series of a symbol, allocating one if the budget allows
+     * @return INVALID_SERIES if the symbol cannot be tracked
+     */
+    uint32_t acquireSeries(SymbolId symbol);
+
+    static size_t bytesPerCandle() {
+        return sizeof(uint64_t) + 5 * sizeof(float);
+    }
+
+    std::array<Ring, RESOLUTION_COUNT> rings;
+    std::vector<uint32_t> seriesOfSymbol;           // SymbolId -> series (INVALID_SERIES = none)
+    uint32_t seriesCount = 0;
+    uint32_t maxSeries = 0;
+    uint64_t recordedCount = 0;
+    uint64_t lateCount = 0;
+    uint64_t untrackedCount = 0;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <string>
+#include "SymbolTable.hpp"
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
@@ -9,32 +10,62 @@
  *
  * This structure represents a single price update message
  * from the real-time data feed (WebSocket or mock data).
+ * The ticker is carried as an interned SymbolId; resolve it with
+ * SymbolTable::global().name() where a string is needed.
  */
 struct PriceUpdate {
-    std::string ticker;              // Ticker symbol (e.g., "AAPL")
+    SymbolId symbol;                 // Interned ticker symbol (e.g., "AAPL")
     float price;                     // New price
     float volume;                    // Trading volume (optional)
     uint64_t timestamp;              // Update timestamp (milliseconds since epoch)
+    uint64_t ingestTime;             // latency::now() when the update entered MarketDataQueue (0 = not yet)
 
     /**
      * @brief Default constructor
      */
     PriceUpdate()
-        : ticker("")
+        : symbol(INVALID_SYMBOL)
         , price(0.0f)
         , volume(0.0f)
         , timestamp(0)
+        , ingestTime(0)
     {}
 
     /**
      * @brief Constructor with parameters
      */
-    PriceUpdate(const std::string& ticker_, float price_, uint64_t timestamp_ = 0)
-        : ticker(ticker_)
+    PriceUpdate(SymbolId symbol_, float price_, uint64_t timestamp_ = 0)
+        : symbol(symbol_)
         , price(price_)
         , volume(0.0f)
         , timestamp(timestamp_)
+        , ingestTime(0)
     {}
+
+    /**
+     * @brief Constructor from a ticker string (interns it; not for hot paths)
+     */
+    PriceUpdate(std::string_view ticker_, float price_, uint64_t timestamp_ = 0)
+        : PriceUpdate(SymbolTable::global().intern(ticker_), price_, timestamp_)
+    {}
+};
+
+/**
+ * @brief OHLC and volume of one symbol's ticks within one time window
+ *
+ * MarketDataQueue delivers only a symbol's latest tick per frame; its tick
+ * windows keep what the merged ticks said, so candles still see intra-frame
+ * extremes and the full traded volume.
+ */
+struct TickWindow {
+    SymbolId symbol = INVALID_SYMBOL;
+    uint32_t ticks = 0;             // Ticks merged into the window
+    uint64_t timestamp = 0;         // Newest tick (milliseconds since epoch)
+    float open = 0.0f;
+    float high = 0.0f;
+    float low = 0.0f;
+    float close = 0.0f;
+    float volume = 0.0f;            // Sum over the ticks
 };
 
 /**
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Dense integer ID of an interned ticker symbol
+ */
+using SymbolId = uint32_t;
+
+/**
+ * @brief Marker for "no symbol" (unknown ticker, unset field)
+ */
+inline constexpr SymbolId INVALID_SYMBOL = 0xFFFFFFFFu;
+
+/**
+ * @brief Interns ticker symbols to dense SymbolIds
+ *
+ * Tickers are interned once, when they are registered (building creation,
+ * feed subscription, mock generator setup). The price pipeline then carries
+ * SymbolIds only, so per-update work is array indexing instead of string
+ * hashing and allocation. IDs are assigned 0, 1, 2, ... and never reused,
+ * which lets consumers keep plain vectors indexed by SymbolId.
+ *
+ * Thread-safe: interning takes an exclusive lock, lookups a shared one.
+ * Names live in a deque so returned references stay valid.
+ */
+class SymbolTable {
+public:
+    /**
+     * @brief Process-wide table shared by the feed, generators and managers
+     */
+    static SymbolTable& global() {
+        static SymbolTable table;
+        return table;
+    }
+
+    /**
+     * @brief Get the ID of a symbol, assigning a new one on first use
+     * @param symbol Ticker symbol (e.g., "AAPL")
+     * @return Symbol ID
+     */
+    SymbolId intern(std::string_view symbol) {
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto it = ids.find(symbol);
+            if (it != ids.end()) {
+                return it->second;
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(symbol);
+        if (it != ids.end()) {
+            return it->second;  // Interned by another thread in the meantime
+        }
+
+        SymbolId id = static_cast<SymbolId>(names.size());
+        const std::string& stored = names.emplace_back(symbol);
+        ids.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    /**
+     * @brief Look up a symbol without interning it
+     * @param symbol Ticker symbol
+     * @return Symbol ID (INVALID_SYMBOL if never interned)
+     */
+    SymbolId find(std::string_view symbol) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(symbol);
+        return it != ids.end() ? it->second : INVALID_SYMBOL;
+    }
+
+    /**
+     * @brief Get the ticker string of an ID (for UI and logging)
+     * @param id Symbol ID
+     * @return Ticker symbol (empty for unknown IDs)
+     */
+    const std::string& name(SymbolId id) const {
+        static const std::string empty;
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return id < names.size() ? names[id] : empty;
+    }
+
+    /**
+     * @brief Get number of interned symbols (one past the largest ID)
+     */
+    size_t size() const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return names.size();
+    }
+
+private:
+    mutable std::shared_mutex mutex;
+    std::deque<std::string> names;                           // id -> ticker
+    std::unordered_map<std::string_view, SymbolId> ids;      // ticker -> id (views into names)
+};
@@ -0,0 +1,168 @@
+#include "TickCodec.hpp"
+#include "MarketDataQueue.hpp"
+#include "src/utils/LatencyTracer.hpp"
+#include <algorithm>
+#include <limits>
+
+using namespace tickwire;
+
+namespace {
+
+TickFrameHeader makeHeader(FrameType type, uint32_t count, uint32_t payloadBytes) {
+    TickFrameHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.type = static_cast<uint16_t>(type);
+    header.count = count;
+    header.payloadBytes = payloadBytes;
+    return header;
+}
+
+uint32_t toWireVolume(float volume) {
+    if (!(volume > 0.0f)) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::min<double>(std::llround(volume), std::numeric_limits<uint32_t>::max()));
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// TickEncoder
+// ============================================================================
+
+size_t TickEncoder::encodeTicks(std::span<const PriceUpdate> updates, std::span<std::byte> out) {
+    const size_t size = tickFrameSize(updates.size());
+    if (out.size() < size || size - sizeof(TickFrameHeader) > MAX_FRAME_PAYLOAD) {
+        return 0;
+    }
+
+    TickFrameHeader header = makeHeader(FrameType::TickBatch,
+                                        static_cast<uint32_t>(updates.size()),
+                                        static_cast<uint32_t>(size - sizeof(TickFrameHeader)));
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    std::byte* cursor = out.data() + sizeof(header);
+    for (const auto& update : updates) {
+        TickRecord record;
+        record.symbol = update.symbol;
+        record.volume = toWireVolume(update.volume);
+        record.price = toFixedPrice(update.price);
+        record.timestamp = update.timestamp;
+        std::memcpy(cursor, &record, sizeof(record));
+        cursor += sizeof(record);
+    }
+    return size;
+}
+
+void TickEncoder::appendTicks(std::span<const PriceUpdate> updates, std::vector<std::byte>& out) {
+    size_t offset = out.size();
+    out.resize(offset + tickFrameSize(updates.size()));
+    size_t written = encodeTicks(updates, std::span<std::byte>(out).subspan(offset));
+    out.resize(offset + written);
+}
+
+size_t TickEncoder::appendSymbolDirectory(std::span<const SymbolId> symbols, std::vector<std::byte>& out) {
+    const SymbolTable& table = SymbolTable::global();
+    constexpr size_t ENTRY_OVERHEAD = sizeof(uint32_t) + sizeof(uint16_t);
+
+    size_t written = 0;
+    size_t frameOffset = 0;
+    uint32_t frameCount = 0;
+    auto closeFrame = [&]() {
+        if (frameCount == 0) {
+            return;
+        }
+        size_t payloadBytes = out.size() - frameOffset - sizeof(TickFrameHeader);
+        TickFrameHeader header = makeHeader(FrameType::SymbolDirectory, frameCount,
+                                            static_cast<uint32_t>(payloadBytes));
+        std::memcpy(out.data() + frameOffset, &header, sizeof(header));
+        frameCount = 0;
+    };
+
+    for (SymbolId symbol : symbols) {
+        const std::string& name = table.name(symbol);
+        if (name.size() > std::numeric_limits<uint16_t>::max()) {
+            continue;  // Not representable; its ticks stay unbound and are rejected
+        }
+
+        // Start a new frame when this entry would overflow the current one
+        size_t entryBytes = ENTRY_OVERHEAD + name.size();
+        if (frameCount > 0 && out.size() + entryBytes - frameOffset - sizeof(TickFrameHeader) > MAX_FRAME_PAYLOAD) {
+            closeFrame();
+        }
+        if (frameCount == 0) {
+            frameOffset = out.size();
+            out.resize(frameOffset + sizeof(TickFrameHeader));
+        }
+
+        uint32_t wireId = symbol;
+        uint16_t length = static_cast<uint16_t>(name.size());
+        size_t offset = out.size();
+        out.resize(offset + entryBytes);
+        std::byte* cursor = out.data() + offset;
+        std::memcpy(cursor, &wireId, sizeof(wireId));
+        cursor += sizeof(wireId);
+        std::memcpy(cursor, &length, sizeof(length));
+        cursor += sizeof(length);
+        std::memcpy(cursor, name.data(), length);
+
+        ++frameCount;
+        ++written;
+    }
+    closeFrame();
+    return written;
+}
+
+// ============================================================================
+// TickDecoder
+// ============================================================================
+
+TickDecoder::Result TickDecoder::decode(std::span<const std::byte> buffer, MarketDataQueue& queue) {
+    // One clock read per received buffer: every tick in it arrived together
+    const uint64_t ingestTime = latency::now();
+    return decode(buffer, [&queue, ingestTime](const PriceUpdate& update) { return queue.push(update, ingestTime); });
+}
+
+void TickDecoder::mapSymbol(uint32_t wireId, SymbolId symbol) {
+    if (wireId >= wireToSymbol.size()) {
+        wireToSymbol.resize(static_cast<size_t>(wireId) + 1, INVALID_SYMBOL);
+    }
+    wireToSymbol[wireId] = symbol;
+}
+
+SymbolId TickDecoder::translateSlow(uint32_t wireId) {
+    // No directory binding: only a same-process feed may use its local SymbolIds
+    if (!identityFallback || wireId >= SymbolTable::global().size()) {
+        return INVALID_SYMBOL;
+    }
+    mapSymbol(wireId, wireId);
+    return wireId;
+}
+
+bool TickDecoder::decodeDirectory(std::span<const std::byte> payload, uint32_t count) {
+    SymbolTable& table = SymbolTable::global();
+    const std::byte* cursor = payload.data();
+    const std::byte* end = cursor + payload.size();
+
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t wireId;
+        uint16_t length;
+        if (static_cast<size_t>(end - cursor) < sizeof(wireId) + sizeof(length)) {
+            return false;
+        }
+        std::memcpy(&wireId, cursor, sizeof(wireId));
+        cursor += sizeof(wireId);
+        std::memcpy(&length, cursor, sizeof(length));
+        cursor += sizeof(length);
+
+        if (static_cast<size_t>(end - cursor) < length || wireId >= MAX_WIRE_SYMBOLS) {
+            return false;
+        }
+        std::string_view name(reinterpret_cast<const char*>(cursor), length);
+        cursor += length;
+
+        mapSymbol(wireId, table.intern(name));
+    }
+    return cursor == end;
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include "PriceUpdate.hpp"
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+class MarketDataQueue;
+
+/**
+ * @brief Binary tick wire/file format
+ *
+ * A stream is a sequence of self-delimiting frames, each a 16-byte
+ * TickFrameHeader followed by payloadBytes of payload. All fields are
+ * little-endian and records are fixed-size, so a frame can be decoded in
+ * place from a socket or file buffer without parsing or allocation.
+ *
+ *   TickBatch frame:        count x TickRecord (24 bytes each)
+ *   SymbolDirectory frame:  count x { u32 wireId, u16 length, char name[length] }
+ *
+ * Wire symbol IDs are the feed's instrument numbers. A SymbolDirectory frame
+ * (sent once per session, or at the start of a file) binds them to ticker
+ * names; the decoder interns those and translates wire IDs to local
+ * SymbolIds with a vector lookup per tick.
+ */
+namespace tickwire {
+
+static_assert(std::endian::native == std::endian::little,
+              "Tick wire format is decoded in place and assumes a little-endian host");
+
+inline constexpr uint32_t MAGIC = 0x424B544Du;      // "MTKB"
+inline constexpr uint16_t VERSION = 1;
+inline constexpr int64_t PRICE_SCALE = 10000;        // Fixed-point price: 1e-4 units
+inline constexpr uint32_t MAX_FRAME_PAYLOAD = 1u << 24;
+inline constexpr uint32_t MAX_WIRE_SYMBOLS = 1u << 24;   // Bounds the translation table
+
+enum class FrameType : uint16_t {
+    TickBatch = 1,
+    SymbolDirectory = 2
+};
+
+#pragma pack(push, 1)
+struct TickFrameHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t type;              // FrameType
+    uint32_t count;             // Records (ticks or directory entries)
+    uint32_t payloadBytes;      // Bytes following this header
+};
+
+struct TickRecord {
+    uint32_t symbol;            // Wire symbol ID
+    uint32_t volume;            // Traded quantity
+    int64_t price;              // Price * PRICE_SCALE
+    uint64_t timestamp;         // Exchange timestamp (milliseconds since epoch)
+};
+#pragma pack(pop)
+
+static_assert(sizeof(TickFrameHeader) == 16);
+static_assert(sizeof(TickRecord) == 24);
+
+inline int64_t toFixedPrice(float price) {
+    return std::llround(static_cast<double>(price) * PRICE_SCALE);
+}
+
+inline float fromFixedPrice(int64_t price) {
+    return static_cast<float>(static_cast<double>(price) / PRICE_SCALE);
+}
+
+/**
+ * @brief Bytes needed to encode a tick batch frame
+ */
+inline constexpr size_t tickFrameSize(size_t tickCount) {
+    return sizeof(TickFrameHeader) + tickCount * sizeof(TickRecord);
+}
+
+} // namespace tickwire
+
+/**
+ * @brief Encodes PriceUpdates into tick wire frames (feed side, recorders, tools)
+ *
+ * Local SymbolIds are written as wire IDs; pair the ticks with a directory
+ * frame of the same symbols so another process can resolve them.
+ */
+class TickEncoder {
+public:
+    /**
+     * @brief Encode one tick batch frame into a caller buffer
+     * @param updates Ticks to encode
+     * @param out Destination (at least tickwire::tickFrameSize(updates.size()) bytes)
+     * @return Bytes written, or 0 if out is too small
+     */
+    static size_t encodeTicks(std::span<const PriceUpdate> updates, std::span<std::byte> out);
+
+    /**
+     * @brief Append one tick batch frame to a growable buffer
+     */
+    static void appendTicks(std::span<const PriceUpdate> updates, std::vector<std::byte>& out);
+
+    /**
+     * @brief Append symbol directory frames binding each symbol's ID to its name
+     *
+     * Splits into several frames when one would exceed MAX_FRAME_PAYLOAD.
+     * Symbols whose name is longer than 65535 bytes cannot be encoded and
+     * are skipped.
+     *
+     * @return Number of symbols written
+     */
+    static size_t appendSymbolDirectory(std::span<const SymbolId> symbols, std::vector<std::byte>& out);
+};
+
+/**
+ * @brief Zero-copy tick frame decoder
+ *
+ * Reads frames straight out of the receive buffer: each record is loaded
+ * with a fixed-size memcpy into a stack PriceUpdate and handed to the sink,
+ * so decoding a tick performs no allocation and no copy of the buffer.
+ * Partial trailing frames are left unconsumed for the next call, which
+ * lets stream readers append to one buffer and compact it.
+ *
+ * The decoder owns the wire-ID translation table; only SymbolDirectory
+ * frames allocate. Ticks whose wire ID no directory has bound are rejected.
+ */
+class TickDecoder {
+public:
+    enum class Status {
+        Ok,             // Every complete frame decoded; buffer fully consumed
+        NeedMoreData,   // Stopped at a partial frame (consumed < buffer size)
+        Corrupt         // Bad magic/version/size; stream must be resynchronized
+    };
+
+    struct Result {
+        Status status = Status::Ok;
+        size_t bytesConsumed = 0;   // Complete frames only
+        uint32_t frames = 0;
+        uint32_t ticks = 0;         // Ticks handed to the sink
+        uint32_t rejected = 0;      // Unbound wire IDs plus ticks the sink refused
+    };
+
+    /**
+     * @brief Decode into the ingestion queue
+     */
+    Result decode(std::span<const std::byte> buffer, MarketDataQueue& queue);
+
+    /**
+     * @brief Decode into an arbitrary sink
+     * @param sink Callable bool(const PriceUpdate&); false counts as rejected
+     */
+    template<typename Sink>
+    Result decode(std::span<const std::byte> buffer, Sink&& sink);
+
+    /**
+     * @brief Bind a wire ID to a local symbol without a directory frame
+     *
+     * Ticks with an unbound wire ID are rejected unless the identity
+     * fallback is enabled.
+     */
+    void mapSymbol(uint32_t wireId, SymbolId symbol);
+
+    /**
+     * @brief Accept unbound wire IDs as local SymbolIds of the same value (default off)
+     *
+     * Only for feeds encoded by this process, whose wire IDs are its own
+     * SymbolIds; another process's IDs would land on unrelated tickers.
+     */
+    void setIdentityFallback(bool enabled) { identityFallback = enabled; }
+
+    /**
+     * @brief Forget every wire ID binding (new session)
+     */
+    void resetSymbols() { wireToSymbol.clear(); }
+
+private:
+    SymbolId translate(uint32_t wireId) {
+        if (wireId < wireToSymbol.size()) {
+            SymbolId symbol = wireToSymbol[wireId];
+            if (symbol != INVALID_SYMBOL) {
+                return symbol;
+            }
+        }
+        return translateSlow(wireId);
+    }
+
+    SymbolId translateSlow(uint32_t wireId);
+    bool decodeDirectory(std::span<const std::byte> payload, uint32_t count);
+
+    std::vector<SymbolId> wireToSymbol;   // Wire ID -> local SymbolId
+    bool identityFallback = false;
+};
+
+template<typename Sink>
+TickDecoder::Result TickDecoder::decode(std::span<const std::byte> buffer, Sink&& sink) {
+    using namespace tickwire;
+
+    Result result;
+    const std::byte* cursor = buffer.data();
+    const std::byte* end = cursor + buffer.size();
+
+    while (cursor != end) {
+        if (static_cast<size_t>(end - cursor) < sizeof(TickFrameHeader)) {
+            result.status = Status::NeedMoreData;
+            break;
+        }
+
+        TickFrameHeader header;
+        std::memcpy(&header, cursor, sizeof(header));
+        if (header.magic != MAGIC || header.version != VERSION || header.payloadBytes > MAX_FRAME_PAYLOAD) {
+            result.status = Status::Corrupt;
+            break;
+        }
+        if (static_cast<size_t>(end - cursor) < sizeof(header) + header.payloadBytes) {
+            result.status = Status::NeedMoreData;
+            break;
+        }
+
+        const std::byte* payload = cursor + sizeof(header);
+        auto type = static_cast<FrameType>(header.type);
+
+        if (type == FrameType::TickBatch) {
+            if (static_cast<uint64_t>(header.count) * sizeof(TickRecord) != header.payloadBytes) {
+                result.status = Status::Corrupt;
+                break;
+            }
+
+            for (uint32_t i = 0; i < header.count; ++i) {
+                TickRecord record;
+                std::memcpy(&record, payload + i * sizeof(TickRecord), sizeof(record));
+
+                PriceUpdate update;
+                update.symbol = translate(record.symbol);
+                if (update.symbol == INVALID_SYMBOL) {
+                    result.rejected++;
+                    continue;
+                }
+                update.price = fromFixedPrice(record.price);
+                update.volume = static_cast<float>(record.volume);
+                update.timestamp = record.timestamp;
+
+                if (sink(update)) {
+                    result.ticks++;
+                } else {
+                    result.rejected++;
+                }
+            }
+        } else if (type == FrameType::SymbolDirectory) {
+            if (!decodeDirectory({payload, header.payloadBytes}, header.count)) {
+                result.status = Status::Corrupt;
+                break;
+            }
+        }
+        // Unknown frame types are skipped so newer feeds stay readable
+
+        cursor = payload + header.payloadBytes;
+        result.frames++;
+    }
+
+    result.bytesConsumed = static_cast<size_t>(cursor - buffer.data());
+    return result;
+}
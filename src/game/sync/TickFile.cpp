@@ -0,0 +1,345 @@
+#include "TickFile.hpp"
+#include "src/utils/Logger.hpp"
+#include <algorithm>
+
+using namespace tickfile;
+
+namespace {
+
+constexpr size_t INITIAL_FILE_SIZE = 16u << 20;
+
+uint64_t maxTimestamp(std::span<const PriceUpdate> updates) {
+    uint64_t newest = 0;
+    for (const auto& update : updates) {
+        newest = std::max(newest, update.timestamp);
+    }
+    return newest;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// TickFileWriter
+// ============================================================================
+
+bool TickFileWriter::open(const std::string& path) {
+    close();
+    if (!file.create(path, INITIAL_FILE_SIZE)) {
+        return false;
+    }
+
+    dataEnd = sizeof(FileHeader);
+    tickCount = 0;
+    firstTimestamp = 0;
+    frameTimestamp = 0;
+    index.clear();
+    symbolRecorded.clear();
+    writeHeader(0);
+
+    LOG_INFO("TickFile") << "Recording ticks to " << path;
+    return true;
+}
+
+bool TickFileWriter::append(std::span<const PriceUpdate> updates, uint64_t captureTimestamp) {
+    if (!file.isOpen() || updates.empty()) {
+        return file.isOpen();
+    }
+
+    // Ticks without an exchange timestamp replay at the time they were captured
+    stamped.assign(updates.begin(), updates.end());
+    for (auto& update : stamped) {
+        if (update.timestamp == 0) {
+            update.timestamp = captureTimestamp;
+        }
+    }
+
+    if (!appendDirectory(stamped)) {
+        return false;  // Ticks without their names could not be replayed
+    }
+
+    std::span<const PriceUpdate> remaining(stamped);
+    while (!remaining.empty()) {
+        auto frameTicks = remaining.first(std::min<size_t>(remaining.size(), MAX_TICKS_PER_FRAME));
+        remaining = remaining.subspan(frameTicks.size());
+
+        size_t frameBytes = tickwire::tickFrameSize(frameTicks.size());
+        if (!ensureCapacity(frameBytes)) {
+            return false;
+        }
+
+        frameTimestamp = std::max(frameTimestamp, maxTimestamp(frameTicks));
+        if (tickCount == 0) {
+            firstTimestamp = frameTimestamp;
+        }
+        addIndexEntry(dataEnd);
+
+        std::span<std::byte> destination(file.data() + dataEnd, frameBytes);
+        dataEnd += TickEncoder::encodeTicks(frameTicks, destination);
+        tickCount += frameTicks.size();
+    }
+
+    writeHeader(0);
+    return true;
+}
+
+void TickFileWriter::close() {
+    if (!file.isOpen()) {
+        return;
+    }
+
+    size_t indexBytes = index.size() * sizeof(IndexEntry);
+    uint64_t indexOffset = 0;
+    uint64_t padding = (alignof(IndexEntry) - dataEnd % alignof(IndexEntry)) % alignof(IndexEntry);
+    if (ensureCapacity(padding + indexBytes)) {
+        indexOffset = dataEnd + padding;
+        std::memcpy(file.data() + indexOffset, index.data(), indexBytes);
+    }
+    writeHeader(indexOffset);
+
+    uint64_t finalSize = indexOffset != 0 ? indexOffset + indexBytes : dataEnd;
+    file.close(static_cast<size_t>(finalSize));
+
+    LOG_INFO("TickFile") << "Recorded " << tickCount << " ticks in " << index.size()
+                         << " frames (" << finalSize / 1024 << " KiB)";
+}
+
+bool TickFileWriter::ensureCapacity(size_t bytes) {
+    size_t required = static_cast<size_t>(dataEnd) + bytes;
+    if (required <= file.size()) {
+        return true;
+    }
+
+    size_t newSize = file.size();
+    while (newSize < required) {
+        newSize *= 2;
+    }
+    if (!file.resize(newSize)) {
+        LOG_ERROR("TickFile") << "Recording stopped: cannot grow tick file to " << newSize << " bytes";
+        return false;
+    }
+    return true;
+}
+
+bool TickFileWriter::appendDirectory(std::span<const PriceUpdate> updates) {
+    // Marked while collecting (deduplicates the batch), unmarked if the write fails
+    newSymbols.clear();
+    for (const auto& update : updates) {
+        if (update.symbol == INVALID_SYMBOL) {
+            continue;
+        }
+        if (update.symbol >= symbolRecorded.size()) {
+            symbolRecorded.resize(static_cast<size_t>(update.symbol) + 1, 0);
+        }
+        if (!symbolRecorded[update.symbol]) {
+            symbolRecorded[update.symbol] = 1;
+            newSymbols.push_back(update.symbol);
+        }
+    }
+    if (newSymbols.empty()) {
+        return true;
+    }
+
+    directoryScratch.clear();
+    TickEncoder::appendSymbolDirectory(newSymbols, directoryScratch);
+    if (!ensureCapacity(directoryScratch.size())) {
+        for (SymbolId symbol : newSymbols) {
+            symbolRecorded[symbol] = 0;
+        }
+        return false;
+    }
+
+    // A large directory spans several frames; each gets an index entry
+    for (size_t offset = 0; offset < directoryScratch.size();) {
+        tickwire::TickFrameHeader header;
+        std::memcpy(&header, directoryScratch.data() + offset, sizeof(header));
+        addIndexEntry(dataEnd + offset);
+        offset += sizeof(header) + header.payloadBytes;
+    }
+    std::memcpy(file.data() + dataEnd, directoryScratch.data(), directoryScratch.size());
+    dataEnd += directoryScratch.size();
+    return true;
+}
+
+void TickFileWriter::addIndexEntry(uint64_t offset) {
+    IndexEntry entry;
+    entry.timestamp = frameTimestamp;
+    entry.offset = offset;
+    entry.firstTick = tickCount;
+    index.push_back(entry);
+}
+
+void TickFileWriter::writeHeader(uint64_t indexOffset) {
+    FileHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.headerBytes = sizeof(FileHeader);
+    header.dataEnd = dataEnd;
+    header.indexOffset = indexOffset;
+    header.indexCount = indexOffset != 0 ? index.size() : 0;
+    header.tickCount = tickCount;
+    header.firstTimestamp = firstTimestamp;
+    header.lastTimestamp = frameTimestamp;
+    std::memcpy(file.data(), &header, sizeof(header));
+}
+
+// ============================================================================
+// TickFileReader
+// ============================================================================
+
+bool TickFileReader::open(const std::string& path) {
+    close();
+    if (!file.openRead(path)) {
+        return false;
+    }
+
+    FileHeader header;
+    if (file.size() < sizeof(header)) {
+        LOG_ERROR("TickFile") << path << " is too small to be a tick file";
+        close();
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION || header.dataEnd > file.size()
+        || header.dataEnd < sizeof(FileHeader)) {
+        LOG_ERROR("TickFile") << path << " is not a valid tick file";
+        close();
+        return false;
+    }
+
+    dataEnd = header.dataEnd;
+    finalized = header.indexOffset != 0
+        && header.indexOffset >= dataEnd
+        && header.indexOffset <= file.size()
+        && header.indexOffset % alignof(IndexEntry) == 0
+        && header.indexCount <= (file.size() - header.indexOffset) / sizeof(IndexEntry);
+
+    if (finalized) {
+        // Use the stored index in place, unless it disagrees with the frames
+        const auto* entries = reinterpret_cast<const IndexEntry*>(file.data() + header.indexOffset);
+        std::span<const IndexEntry> stored(entries, static_cast<size_t>(header.indexCount));
+        finalized = validateIndex(stored);
+        if (finalized) {
+            index = stored;
+            tickCount = header.tickCount;
+            firstTimestamp = header.firstTimestamp;
+            lastTimestamp = header.lastTimestamp;
+        }
+    }
+
+    if (!finalized) {
+        if (!rebuildIndex(dataEnd)) {
+            LOG_ERROR("TickFile") << path << " has corrupt frames";
+            close();
+            return false;
+        }
+        LOG_WARN("TickFile") << path << (header.indexOffset == 0 ? " was not closed cleanly" : " has a damaged index")
+                             << "; rebuilt index of " << index.size() << " frames";
+    }
+
+    LOG_INFO("TickFile") << "Opened " << path << ": " << tickCount << " ticks, "
+                         << (lastTimestamp - firstTimestamp) / 1000.0 << " s";
+    return true;
+}
+
+void TickFileReader::close() {
+    file.close();
+    index = {};
+    rebuiltIndex.clear();
+    dataEnd = 0;
+    tickCount = 0;
+    firstTimestamp = 0;
+    lastTimestamp = 0;
+    finalized = false;
+}
+
+std::span<const std::byte> TickFileReader::getFrameData(size_t frame) const {
+    uint64_t begin = index[frame].offset;
+    uint64_t end = frame + 1 < index.size() ? index[frame + 1].offset : dataEnd;
+    return std::span<const std::byte>(file.data() + begin, static_cast<size_t>(end - begin));
+}
+
+tickwire::FrameType TickFileReader::getFrameType(size_t frame) const {
+    tickwire::TickFrameHeader header;
+    std::memcpy(&header, file.data() + index[frame].offset, sizeof(header));
+    return static_cast<tickwire::FrameType>(header.type);
+}
+
+size_t TickFileReader::findFrame(uint64_t timestamp) const {
+    auto it = std::lower_bound(index.begin(), index.end(), timestamp,
+        [](const IndexEntry& entry, uint64_t value) { return entry.timestamp < value; });
+    return static_cast<size_t>(it - index.begin());
+}
+
+bool TickFileReader::validateIndex(std::span<const IndexEntry> entries) const {
+    using namespace tickwire;
+
+    uint64_t expectedOffset = sizeof(FileHeader);
+    uint64_t previousTimestamp = 0;
+    uint64_t previousTick = 0;
+    for (const IndexEntry& entry : entries) {
+        // Frames are contiguous, so each entry starts where the previous frame ended
+        if (entry.offset != expectedOffset || entry.timestamp < previousTimestamp || entry.firstTick < previousTick
+            || dataEnd - entry.offset < sizeof(TickFrameHeader)) {
+            return false;
+        }
+
+        TickFrameHeader header;
+        std::memcpy(&header, file.data() + entry.offset, sizeof(header));
+        if (header.magic != tickwire::MAGIC || header.payloadBytes > dataEnd - entry.offset - sizeof(header)) {
+            return false;
+        }
+        if (static_cast<FrameType>(header.type) == FrameType::TickBatch
+            && static_cast<uint64_t>(header.count) * sizeof(TickRecord) != header.payloadBytes) {
+            return false;
+        }
+
+        expectedOffset = entry.offset + sizeof(header) + header.payloadBytes;
+        previousTimestamp = entry.timestamp;
+        previousTick = entry.firstTick;
+    }
+    return expectedOffset == dataEnd;
+}
+
+bool TickFileReader::rebuildIndex(uint64_t end) {
+    using namespace tickwire;
+
+    rebuiltIndex.clear();
+    tickCount = 0;
+    firstTimestamp = 0;
+    uint64_t frameTimestamp = 0;
+    uint64_t offset = sizeof(FileHeader);
+
+    // Mirrors TickFileWriter: a frame's replay time is the newest tick timestamp so far
+    while (offset + sizeof(TickFrameHeader) <= end) {
+        TickFrameHeader header;
+        std::memcpy(&header, file.data() + offset, sizeof(header));
+        if (header.magic != tickwire::MAGIC || offset + sizeof(header) + header.payloadBytes > end) {
+            return false;
+        }
+
+        if (static_cast<FrameType>(header.type) == FrameType::TickBatch) {
+            if (static_cast<uint64_t>(header.count) * sizeof(TickRecord) != header.payloadBytes) {
+                return false;
+            }
+            const std::byte* records = file.data() + offset + sizeof(header);
+            for (uint32_t i = 0; i < header.count; ++i) {
+                TickRecord record;
+                std::memcpy(&record, records + i * sizeof(TickRecord), sizeof(record));
+                frameTimestamp = std::max(frameTimestamp, record.timestamp);
+            }
+            if (tickCount == 0) {
+                firstTimestamp = frameTimestamp;
+            }
+        }
+
+        rebuiltIndex.push_back({frameTimestamp, offset, tickCount});
+        if (static_cast<FrameType>(header.type) == FrameType::TickBatch) {
+            tickCount += header.count;
+        }
+        offset += sizeof(header) + header.payloadBytes;
+    }
+
+    index = rebuiltIndex;
+    lastTimestamp = frameTimestamp;
+    return offset == end;
+}
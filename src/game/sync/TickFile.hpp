@@ -0,0 +1,170 @@
+#pragma once
+
+#include "TickCodec.hpp"
+#include "src/utils/MappedFile.hpp"
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Tick file layout (recorded market data for replay)
+ *
+ *   FileHeader (64 bytes)
+ *   tickwire frames (symbol directories and tick batches, append-only)
+ *   IndexEntry[indexCount] (written on close, 8-byte aligned)
+ *
+ * Every frame has an index entry holding its replay time: the newest tick
+ * timestamp seen so far, so entries are non-decreasing and seekable with a
+ * binary search. The header's dataEnd/tickCount are kept current while
+ * recording; a file whose recorder died before close() has indexOffset 0
+ * and its index is rebuilt by scanning the frames, as is a stored index
+ * that does not match the frames.
+ */
+namespace tickfile {
+
+inline constexpr uint32_t MAGIC = 0x464B544Du;      // "MTKF"
+inline constexpr uint16_t VERSION = 1;
+inline constexpr uint32_t MAX_TICKS_PER_FRAME = 4096;   // Seek granularity
+
+#pragma pack(push, 1)
+struct FileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerBytes;
+    uint64_t dataEnd;           // End of the frame region (file offset)
+    uint64_t indexOffset;       // 0 until the recording is closed
+    uint64_t indexCount;
+    uint64_t tickCount;
+    uint64_t firstTimestamp;    // Milliseconds since epoch
+    uint64_t lastTimestamp;
+    uint64_t reserved;
+};
+#pragma pack(pop)
+
+// Stored 8-byte aligned so a finalized index is used in place from the mapping
+struct IndexEntry {
+    uint64_t timestamp;         // Replay time of the frame
+    uint64_t offset;            // File offset of the frame header
+    uint64_t firstTick;         // Ticks recorded before this frame
+};
+
+static_assert(sizeof(FileHeader) == 64);
+static_assert(sizeof(IndexEntry) == 24);
+
+} // namespace tickfile
+
+/**
+ * @brief Append-only, memory-mapped tick recorder
+ *
+ * Frames are encoded straight into the mapping; the file grows by doubling.
+ * Symbols are described by a directory frame the first time they appear,
+ * so any prefix of the file is self-contained.
+ */
+class TickFileWriter {
+public:
+    TickFileWriter() = default;
+    ~TickFileWriter() { close(); }
+
+    TickFileWriter(const TickFileWriter&) = delete;
+    TickFileWriter& operator=(const TickFileWriter&) = delete;
+
+    /**
+     * @brief Create (or truncate) a recording
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Append a batch of ticks
+     * @param updates Ticks in arrival order
+     * @param captureTimestamp Stamped on ticks whose timestamp is 0 (milliseconds since epoch)
+     * @return False if the file could not grow (recording stops)
+     */
+    bool append(std::span<const PriceUpdate> updates, uint64_t captureTimestamp);
+
+    /**
+     * @brief Write the index and truncate the file to its used length
+     */
+    void close();
+
+    bool isOpen() const { return file.isOpen(); }
+    uint64_t getTickCount() const { return tickCount; }
+    uint64_t getBytesWritten() const { return dataEnd; }
+
+private:
+    bool ensureCapacity(size_t bytes);
+    bool appendDirectory(std::span<const PriceUpdate> updates);
+    void addIndexEntry(uint64_t offset);
+    void writeHeader(uint64_t indexOffset);
+
+    MappedFile file;
+    uint64_t dataEnd = 0;
+    uint64_t tickCount = 0;
+    uint64_t firstTimestamp = 0;
+    uint64_t frameTimestamp = 0;                 // Replay time of the newest frame
+    std::vector<tickfile::IndexEntry> index;
+    std::vector<uint8_t> symbolRecorded;         // SymbolId -> described by a directory frame
+    std::vector<SymbolId> newSymbols;            // Scratch
+    std::vector<std::byte> directoryScratch;
+    PriceUpdateBatch stamped;                    // Scratch for timestamp stamping
+};
+
+/**
+ * @brief Read-only view of a tick file (zero-copy frames out of the mapping)
+ */
+class TickFileReader {
+public:
+    /**
+     * @brief Map a recording and load (or rebuild) its index
+     */
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return file.isOpen(); }
+
+    /**
+     * @brief Was the recording closed cleanly (index stored in the file)
+     */
+    bool isFinalized() const { return finalized; }
+
+    size_t getFrameCount() const { return index.size(); }
+    const tickfile::IndexEntry& getFrame(size_t frame) const { return index[frame]; }
+
+    /**
+     * @brief Encoded bytes of one frame (header + payload), pointing into the mapping
+     */
+    std::span<const std::byte> getFrameData(size_t frame) const;
+
+    /**
+     * @brief Frame type without decoding the payload
+     */
+    tickwire::FrameType getFrameType(size_t frame) const;
+
+    /**
+     * @brief First frame whose replay time is >= timestamp (getFrameCount() if none)
+     */
+    size_t findFrame(uint64_t timestamp) const;
+
+    uint64_t getTickCount() const { return tickCount; }
+    uint64_t getFirstTimestamp() const { return firstTimestamp; }
+    uint64_t getLastTimestamp() const { return lastTimestamp; }
+
+private:
+    bool rebuildIndex(uint64_t dataEnd);
+
+    /**
+     * @brief Check a stored index against the frames it points to
+     *
+     * Entries must be in ascending time and offset order and tile the frame
+     * region exactly, each on a well-formed frame header.
+     */
+    bool validateIndex(std::span<const tickfile::IndexEntry> entries) const;
+
+    MappedFile file;
+    std::span<const tickfile::IndexEntry> index;          // Into the mapping or rebuiltIndex
+    std::vector<tickfile::IndexEntry> rebuiltIndex;
+    uint64_t dataEnd = 0;
+    uint64_t tickCount = 0;
+    uint64_t firstTimestamp = 0;
+    uint64_t lastTimestamp = 0;
+    bool finalized = false;
+};
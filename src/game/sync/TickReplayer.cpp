@@ -0,0 +1,90 @@
+#include "TickReplayer.hpp"
+#include "MarketDataQueue.hpp"
+#include <algorithm>
+
+TickReplayer::TickReplayer(const TickFileReader& reader_)
+    : reader(reader_)
+{
+    // Bind every wire ID up front so seeks past a directory frame still resolve
+    for (size_t frame = 0; frame < reader.getFrameCount(); ++frame) {
+        if (reader.getFrameType(frame) == tickwire::FrameType::SymbolDirectory) {
+            decoder.decode(reader.getFrameData(frame), [](const PriceUpdate&) { return true; });
+        }
+    }
+    seek(reader.getFirstTimestamp());
+}
+
+void TickReplayer::seek(uint64_t timestamp) {
+    nextFrame = reader.findFrame(timestamp);
+    if (nextFrame < reader.getFrameCount()) {
+        clock = static_cast<double>(std::max(reader.getFrame(nextFrame).timestamp, reader.getFirstTimestamp()));
+    } else {
+        clock = static_cast<double>(reader.getLastTimestamp());
+    }
+}
+
+void TickReplayer::seekFraction(float fraction) {
+    fraction = std::clamp(fraction, 0.0f, 1.0f);
+    uint64_t span = reader.getLastTimestamp() - reader.getFirstTimestamp();
+    seek(reader.getFirstTimestamp() + static_cast<uint64_t>(static_cast<double>(span) * fraction));
+}
+
+uint32_t TickReplayer::advance(float deltaTime, MarketDataQueue& queue) {
+    const size_t frameCount = reader.getFrameCount();
+    if (frameCount == 0) {
+        return 0;
+    }
+
+    if (speed > 0.0f) {
+        clock += static_cast<double>(deltaTime) * 1000.0 * speed;
+    }
+
+    uint32_t delivered = 0;
+    size_t framesVisited = 0;
+    while (delivered < tickBudget && framesVisited++ < frameCount) {
+        if (nextFrame >= frameCount) {
+            if (!looping) {
+                break;
+            }
+            // The next call starts over, so the caller sees the wrap between two calls
+            seek(reader.getFirstTimestamp());
+            ++loopCount;
+            break;
+        }
+
+        const auto& entry = reader.getFrame(nextFrame);
+        if (speed > 0.0f && static_cast<double>(entry.timestamp) > clock) {
+            break;  // Not due yet
+        }
+
+        // Directory frames were applied up front; decoding them again is harmless
+        auto result = decoder.decode(reader.getFrameData(nextFrame), queue);
+        delivered += result.ticks;
+        ticksReplayed += result.ticks;
+        ticksRejected += result.rejected;
+
+        if (speed == 0.0f) {
+            clock = static_cast<double>(entry.timestamp);
+        }
+        ++nextFrame;
+    }
+
+    // A budget-limited frame must not let the clock run ahead of the data indefinitely
+    if (speed > 0.0f && nextFrame < frameCount) {
+        double due = static_cast<double>(reader.getFrame(nextFrame).timestamp);
+        if (delivered >= tickBudget && clock > due) {
+            clock = due;
+        }
+    }
+    return delivered;
+}
+
+float TickReplayer::getProgress() const {
+    uint64_t first = reader.getFirstTimestamp();
+    uint64_t last = reader.getLastTimestamp();
+    if (last <= first) {
+        return nextFrame >= reader.getFrameCount() ? 1.0f : 0.0f;
+    }
+    double position = std::clamp(clock, static_cast<double>(first), static_cast<double>(last));
+    return static_cast<float>((position - static_cast<double>(first)) / static_cast<double>(last - first));
+}
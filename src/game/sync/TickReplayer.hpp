@@ -0,0 +1,92 @@
+#pragma once
+
+#include "TickFile.hpp"
+
+class MarketDataQueue;
+
+/**
+ * @brief Replays a tick file into the ingestion queue on the frame clock
+ *
+ * Speed 1 reproduces the recorded inter-frame timing, speed N compresses it
+ * N times, and speed 0 replays as fast as possible (each advance() delivers
+ * up to the tick budget). The budget also bounds catch-up after a seek or a
+ * long frame so one frame never floods the queue.
+ *
+ * All symbol directories are decoded when the replayer is created, so
+ * seeking anywhere in the file resolves every symbol.
+ */
+class TickReplayer {
+public:
+    explicit TickReplayer(const TickFileReader& reader);
+
+    /**
+     * @brief Replay speed multiplier (0 = as fast as possible)
+     */
+    void setSpeed(float multiplier) { speed = multiplier < 0.0f ? 0.0f : multiplier; }
+    float getSpeed() const { return speed; }
+
+    /**
+     * @brief Maximum ticks delivered per advance() call
+     */
+    void setTickBudget(uint32_t ticks) { tickBudget = ticks > 0 ? ticks : 1; }
+
+    /**
+     * @brief Restart from the beginning when the end is reached
+     *
+     * A wrap ends the advance() call that hit it, so ticks from both sides
+     * of the jump back in market time are never pushed in one call.
+     */
+    void setLooping(bool loop) { looping = loop; }
+
+    /**
+     * @brief Jump to the first frame recorded at or after timestamp
+     */
+    void seek(uint64_t timestamp);
+
+    /**
+     * @brief Jump to a fraction [0, 1] of the recording's time span
+     */
+    void seekFraction(float fraction);
+
+    /**
+     * @brief Advance the replay clock and push every frame now due
+     * @param deltaTime Wall-clock seconds since the previous call
+     * @param queue Ingestion queue (the frame loop drains it as usual)
+     * @return Ticks delivered
+     */
+    uint32_t advance(float deltaTime, MarketDataQueue& queue);
+
+    bool isFinished() const { return nextFrame >= reader.getFrameCount() && !looping; }
+
+    /**
+     * @brief Current position in recorded time (milliseconds since epoch)
+     */
+    uint64_t getReplayTime() const { return static_cast<uint64_t>(clock); }
+
+    /**
+     * @brief Position as a fraction of the recording's time span
+     */
+    float getProgress() const;
+
+    uint64_t getTicksReplayed() const { return ticksReplayed; }
+    uint64_t getTicksRejected() const { return ticksRejected; }
+
+    /**
+     * @brief Times the replay wrapped to the start (market time jumped back)
+     */
+    uint64_t getLoopCount() const { return loopCount; }
+
+private:
+    const TickFileReader& reader;
+    TickDecoder decoder;
+
+    size_t nextFrame = 0;
+    double clock = 0.0;              // Replay time (milliseconds since epoch)
+    float speed = 1.0f;
+    uint32_t tickBudget = 1u << 16;
+    bool looping = false;
+
+    uint64_t ticksReplayed = 0;
+    uint64_t ticksRejected = 0;
+    uint64_t loopCount = 0;
+};
@@ -0,0 +1,210 @@
+#include "WorldHistory.hpp"
+#include <algorithm>
+#include <chrono>
+
+WorldHistory::WorldHistory(const WorldHistoryConfig& config)
+    : keyframeIntervalMs(std::max<uint64_t>(config.keyframeIntervalMs, 1))
+    , memoryBudget(config.memoryBudget)
+    , deltaCapacity(std::max<size_t>(config.memoryBudget / 2 / sizeof(Delta), 64))
+    , keyframeBudget(config.memoryBudget / 2)
+{
+}
+
+void WorldHistory::applyToHead(SymbolId symbol, float price) {
+    if (symbol >= headKnown.size()) {
+        size_t size = static_cast<size_t>(symbol) + 1;
+        headPrice.resize(size, 0.0f);
+        headPrevious.resize(size, 0.0f);
+        headKnown.resize(size, 0);
+    }
+    if (!headKnown[symbol]) {
+        headKnown[symbol] = 1;
+        headSymbols.push_back(symbol);
+        headPrevious[symbol] = price;
+    } else {
+        headPrevious[symbol] = headPrice[symbol];
+    }
+    headPrice[symbol] = price;
+}
+
+void WorldHistory::seed(std::span<const SymbolId> symbols, std::span<const float> prices,
+                        std::span<const float> previousPrices) {
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        SymbolId symbol = symbols[i];
+        if (symbol == INVALID_SYMBOL || (symbol < headKnown.size() && headKnown[symbol])) {
+            continue;
+        }
+        applyToHead(symbol, prices[i]);
+        headPrevious[symbol] = previousPrices[i];
+        seedPending = true;     // Seeded symbols have no deltas: the next batch takes a keyframe
+    }
+}
+
+void WorldHistory::record(const PriceUpdateBatch& updates, uint64_t timestamp) {
+    timestamp = std::max(timestamp, newestTime);
+
+    uint32_t count = 0;
+    for (const auto& update : updates) {
+        if (update.symbol != INVALID_SYMBOL) {
+            applyToHead(update.symbol, update.price);
+            ++count;
+        }
+    }
+    if (count == 0 && !seedPending) {
+        return;
+    }
+
+    // A keyframe instead of a frame when one is due, or when these deltas
+    // would let the run since the last keyframe pass a quarter of the ring
+    bool keyframeDue = keyframes.empty() || seedPending
+        || timestamp - keyframes.back().timestamp >= keyframeIntervalMs
+        || deltasSinceKeyframe + count > deltaCapacity / 4;
+    newestTime = timestamp;
+    if (keyframeDue) {
+        captureKeyframe(timestamp);
+        return;
+    }
+
+    // Make room in the ring: deltas still referenced go with their keyframe
+    while (!frames.empty() && frames.front().firstDelta + deltaCapacity < deltaCount + count) {
+        evictOldestKeyframe();
+    }
+
+    uint64_t firstDelta = deltaCount;
+    for (const auto& update : updates) {
+        if (update.symbol == INVALID_SYMBOL) {
+            continue;
+        }
+        Delta delta{update.symbol, update.price};
+        if (deltas.size() < deltaCapacity) {
+            if (deltas.size() == deltas.capacity()) {
+                deltas.reserve(std::min(deltaCapacity, std::max<size_t>(deltas.size() * 2, 4096)));
+            }
+            deltas.push_back(delta);
+        } else {
+            deltas[deltaCount % deltaCapacity] = delta;
+        }
+        ++deltaCount;
+    }
+    frames.push_back(Frame{timestamp, firstDelta, count});
+    deltasSinceKeyframe += count;
+}
+
+void WorldHistory::captureKeyframe(uint64_t timestamp) {
+    Keyframe& keyframe = keyframes.emplace_back();
+    keyframe.timestamp = timestamp;
+    keyframe.firstFrame = frameBase + frames.size();
+    keyframe.symbol = headSymbols;
+    keyframe.price.resize(headSymbols.size());
+    keyframe.previousPrice.resize(headSymbols.size());
+    for (size_t i = 0; i < headSymbols.size(); ++i) {
+        keyframe.price[i] = headPrice[headSymbols[i]];
+        keyframe.previousPrice[i] = headPrevious[headSymbols[i]];
+    }
+    keyframeBytes += keyframe.bytes();
+    deltasSinceKeyframe = 0;
+    seedPending = false;
+
+    // The newest keyframe always stays, even if it alone exceeds the budget
+    while (keyframeBytes > keyframeBudget && keyframes.size() > 1) {
+        evictOldestKeyframe();
+    }
+}
+
+void WorldHistory::evictOldestKeyframe() {
+    keyframeBytes -= keyframes.front().bytes();
+    keyframes.pop_front();
+    ++evictedKeyframes;
+
+    uint64_t keepFrom = keyframes.empty() ? frameBase + frames.size() : keyframes.front().firstFrame;
+    while (frameBase < keepFrom && !frames.empty()) {
+        frames.pop_front();
+        ++frameBase;
+    }
+}
+
+void WorldHistory::clear() {
+    headPrice.clear();
+    headPrevious.clear();
+    headKnown.clear();
+    headSymbols.clear();
+    keyframes.clear();
+    frames.clear();
+    frameBase = 0;
+    deltas.clear();
+    deltaCount = 0;
+    deltasSinceKeyframe = 0;
+    newestTime = 0;
+    keyframeBytes = 0;
+    seedPending = false;
+}
+
+bool WorldHistory::reconstruct(uint64_t timestamp, State& out) {
+    if (keyframes.empty() || timestamp < keyframes.front().timestamp) {
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    // Newest keyframe at or before the time
+    auto after = std::upper_bound(keyframes.begin(), keyframes.end(), timestamp,
+                                  [](uint64_t time, const Keyframe& keyframe) { return time < keyframe.timestamp; });
+    const Keyframe& keyframe = *(after - 1);
+
+    out.timestamp = keyframe.timestamp;
+    out.symbol.assign(keyframe.symbol.begin(), keyframe.symbol.end());
+    out.price.assign(keyframe.price.begin(), keyframe.price.end());
+    out.previousPrice.assign(keyframe.previousPrice.begin(), keyframe.previousPrice.end());
+
+    if (slotOfSymbol.size() < headKnown.size()) {
+        slotOfSymbol.resize(headKnown.size(), INVALID_SLOT);
+    }
+    for (uint32_t slot = 0; slot < out.symbol.size(); ++slot) {
+        slotOfSymbol[out.symbol[slot]] = slot;
+    }
+
+    // Play the frames after it forward
+    size_t applied = 0;
+    for (uint64_t f = keyframe.firstFrame - frameBase; f < frames.size(); ++f) {
+        const Frame& frame = frames[f];
+        if (frame.timestamp > timestamp) {
+            break;
+        }
+        for (uint64_t sequence = frame.firstDelta; sequence < frame.firstDelta + frame.deltaCount; ++sequence) {
+            const Delta& delta = deltaAt(sequence);
+            uint32_t& slot = slotOfSymbol[delta.symbol];
+            if (slot == INVALID_SLOT) {
+                // First tick of a symbol since the keyframe
+                slot = static_cast<uint32_t>(out.symbol.size());
+                out.symbol.push_back(delta.symbol);
+                out.price.push_back(delta.price);
+                out.previousPrice.push_back(delta.price);
+                continue;
+            }
+            out.previousPrice[slot] = out.price[slot];
+            out.price[slot] = delta.price;
+        }
+        out.timestamp = frame.timestamp;
+        applied += frame.deltaCount;
+    }
+
+    for (SymbolId symbol : out.symbol) {
+        slotOfSymbol[symbol] = INVALID_SLOT;
+    }
+
+    lastReconstructDeltas = applied;
+    lastReconstructMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+WorldHistory::Stats WorldHistory::getStats() const {
+    Stats stats;
+    stats.keyframes = keyframes.size();
+    stats.frames = frames.size();
+    stats.deltas = frames.empty() ? 0 : deltaCount - frames.front().firstDelta;
+    stats.memoryBytes = keyframeBytes + deltas.capacity() * sizeof(Delta) + frames.size() * sizeof(Frame);
+    stats.memoryBudget = memoryBudget;
+    stats.evictedKeyframes = evictedKeyframes;
+    stats.lastReconstructMs = lastReconstructMs;
+    stats.lastReconstructDeltas = lastReconstructDeltas;
+    return stats;
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "PriceUpdate.hpp"
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Sizing of a WorldHistory
+ */
+struct WorldHistoryConfig {
+    uint64_t keyframeIntervalMs = 10 * 1000;    // Simulated time between keyframes
+    size_t memoryBudget = 64u << 20;            // Keyframes and deltas together (half each)
+};
+
+/**
+ * @brief Rewindable record of every symbol's price, as keyframes plus per-tick deltas
+ *
+ * The history keeps its own head state (latest price and previous price per
+ * symbol), so it stays correct while the world displays a past state.
+ * record() folds a tick batch into the head and logs it as a frame of
+ * (symbol, price) deltas in a fixed-capacity ring. Every keyframe interval
+ * (or when the deltas since the last keyframe would take a quarter of the
+ * ring) the head is copied column-wise into a keyframe instead.
+ *
+ * reconstruct() rebuilds the state at any retained time from the nearest
+ * earlier keyframe plus at most a quarter ring of deltas. Heights are not
+ * stored: they follow from price and previous price.
+ *
+ * Memory is bounded. The oldest keyframe and the frames up to the next one
+ * are evicted together, so every retained keyframe can be played forward to
+ * the next. A keyframe covers the symbols the history knows at that time.
+ * Symbols with no ticks yet can be added with seed().
+ */
+class WorldHistory {
+public:
+    /**
+     * @brief Price state of every known symbol at one time (columns share an index)
+     */
+    struct State {
+        uint64_t timestamp = 0;                 // Time of the last tick applied
+        std::vector<SymbolId> symbol;
+        std::vector<float> price;
+        std::vector<float> previousPrice;
+    };
+
+    explicit WorldHistory(const WorldHistoryConfig& config = {});
+
+    /**
+     * @brief Add symbols the history has not seen, with their current prices
+     *
+     * For buildings that exist before their first tick. Symbols already known
+     * are left unchanged.
+     */
+    void seed(std::span<const SymbolId> symbols, std::span<const float> prices,
+              std::span<const float> previousPrices);
+
+    /**
+     * @brief Fold one tick batch into the head and log it
+     * @param timestamp Simulation time of the batch (milliseconds since epoch;
+     *        earlier than the newest frame is treated as the newest)
+     */
+    void record(const PriceUpdateBatch& updates, uint64_t timestamp);
+
+    /**
+     * @brief Forget all keyframes, deltas and the head
+     */
+    void clear();
+
+    bool empty() const { return keyframes.empty(); }
+
+    /**
+     * @brief Earliest time reconstruct() can rebuild (0 if empty)
+     */
+    uint64_t getOldestTime() const { return keyframes.empty() ? 0 : keyframes.front().timestamp; }
+
+    /**
+     * @brief Time of the newest keyframe or frame (0 if empty)
+     */
+    uint64_t getNewestTime() const { return newestTime; }
+
+    /**
+     * @brief Rebuild the state as of a time
+     * @param timestamp Any time; later than getNewestTime() yields the head
+     * @param out Receives the state (storage reused between calls)
+     * @return False if the time is before the oldest keyframe
+     */
+    bool reconstruct(uint64_t timestamp, State& out);
+
+    /**
+     * @brief Memory and reconstruction counters
+     */
+    struct Stats {
+        size_t keyframes = 0;
+        size_t frames = 0;
+        size_t deltas = 0;              // Delta entries held
+        size_t memoryBytes = 0;         // Keyframes + delta ring + frame index (reserved)
+        size_t memoryBudget = 0;
+        uint64_t evictedKeyframes = 0;
+        float lastReconstructMs = 0.0f;
+        size_t lastReconstructDeltas = 0;   // Deltas applied by the last reconstruct()
+    };
+    Stats getStats() const;
+
+private:
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+
+    struct Delta {
+        SymbolId symbol;
+        float price;
+    };
+
+    /**
+     * @brief One recorded batch: deltas [firstDelta, firstDelta + deltaCount) by absolute sequence
+     */
+    struct Frame {
+        uint64_t timestamp;
+        uint64_t firstDelta;
+        uint32_t deltaCount;
+    };
+
+    /**
+     * @brief Head state at one time; frames from firstFrame (absolute) follow it
+     */
+    struct Keyframe {
+        uint64_t timestamp = 0;
+        uint64_t firstFrame = 0;
+        std::vector<SymbolId> symbol;
+        std::vector<float> price;
+        std::vector<float> previousPrice;
+
+        size_t bytes() const {
+            return symbol.capacity() * sizeof(SymbolId) + (price.capacity() + previousPrice.capacity()) * sizeof(float);
+        }
+    };
+
+    /**
+     * @brief Set a symbol's head price (adding it if unknown)
+     */
+    void applyToHead(SymbolId symbol, float price);
+
+    /**
+     * @brief Copy the head into a new keyframe and evict old ones past the budget
+     */
+    void captureKeyframe(uint64_t timestamp);
+
+    /**
+     * @brief Drop the oldest keyframe and the frames before the next one
+     */
+    void evictOldestKeyframe();
+
+    const Delta& deltaAt(uint64_t sequence) const {
+        return deltas[sequence % deltaCapacity];
+    }
+
+    // Head (latest state), indexed by SymbolId
+    std::vector<float> headPrice;
+    std::vector<float> headPrevious;
+    std::vector<uint8_t> headKnown;
+    std::vector<SymbolId> headSymbols;          // Known symbols, in the order they became known
+
+    // Timeline
+    std::deque<Keyframe> keyframes;
+    std::deque<Frame> frames;
+    uint64_t frameBase = 0;                     // Absolute index of frames.front()
+    std::vector<Delta> deltas;                  // Ring, grows to deltaCapacity
+    uint64_t deltaCount = 0;                    // Deltas ever appended (next sequence)
+    uint64_t deltasSinceKeyframe = 0;
+    uint64_t newestTime = 0;
+    bool seedPending = false;                   // Head has seeded symbols no keyframe holds yet
+
+    // Limits
+    uint64_t keyframeIntervalMs = 0;
+    size_t memoryBudget = 0;
+    size_t deltaCapacity = 0;
+    size_t keyframeBudget = 0;
+    size_t keyframeBytes = 0;
+
+    // reconstruct() scratch
+    std::vector<uint32_t> slotOfSymbol;         // SymbolId -> index into State (INVALID_SLOT = absent)
+
+    uint64_t evictedKeyframes = 0;
+    float lastReconstructMs = 0.0f;
+    size_t lastReconstructDeltas = 0;
+};
@@ -0,0 +1,199 @@
+#include "AnimationPool.hpp"
+#include "AnimationUtils.hpp"
+#include "src/utils/Simd.hpp"
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Easing curve evaluation, selected per lane at compile time
+ *
+ * Vectorized curves must match their AnimationUtils counterpart on [0, 1].
+ */
+template<EasingCurve Curve>
+struct Easing;
+
+template<>
+struct Easing<EasingCurve::Default> {
+    static constexpr bool Vectorized = true;
+
+    // easeInOutCubic without the branch: 4t^3 below 0.5, 1 - 4(1-t)^3 above.
+    // With a = min(t, 0.5) and b = max(t, 0.5) the inactive half contributes
+    // exactly 0.5, which the constant term cancels.
+    static simd::Float apply(simd::Float t) {
+        const simd::Float half(0.5f), four(4.0f), one(1.0f);
+        simd::Float a = min(t, half);
+        simd::Float b = one - max(t, half);
+        return four * (a * a * a - b * b * b) + half;
+    }
+};
+
+template<>
+struct Easing<EasingCurve::Crash> {
+    static constexpr bool Vectorized = true;
+
+    static simd::Float apply(simd::Float t) {
+        return t * t * t;
+    }
+};
+
+template<>
+struct Easing<EasingCurve::Surge> {
+    // pow/sin have no simd::Float form; evaluated per entry
+    static constexpr bool Vectorized = false;
+
+    static float apply(float t) {
+        return AnimationUtils::surgeEasing(t);
+    }
+};
+
+} // anonymous namespace
+
+void AnimationPool::start(uint32_t owner, float startValue, float targetValue, float duration, EasingCurve curve) {
+    remove(owner);
+    if (owner >= slotOfOwner.size()) {
+        slotOfOwner.resize(static_cast<size_t>(owner) + 1, INVALID_SLOT);
+    }
+
+    uint8_t laneIndex = static_cast<uint8_t>(curve);
+    Lane& lane = lanes[laneIndex];
+    uint32_t position = lane.count++;
+    if (lane.count > lane.progress.size()) {
+        size_t padded = simd::padCount(lane.count);
+        lane.start.resize(padded);
+        lane.target.resize(padded);
+        lane.progress.resize(padded);
+        lane.rate.resize(padded);
+        lane.value.resize(padded);
+    }
+
+    lane.owner.push_back(owner);
+    lane.start[position] = startValue;
+    lane.target[position] = targetValue;
+    lane.progress[position] = 0.0f;
+    lane.rate[position] = 1.0f / duration;
+    lane.value[position] = startValue;
+
+    slotOfOwner[owner] = (static_cast<uint32_t>(laneIndex) << LANE_SHIFT) | position;
+    ++activeCount;
+}
+
+void AnimationPool::resume(uint32_t owner, const State& state) {
+    start(owner, state.start, state.target, state.duration, state.curve);
+    uint32_t slot = slotOfOwner[owner];
+    lanes[slot >> LANE_SHIFT].progress[slot & POSITION_MASK] = state.progress;
+}
+
+bool AnimationPool::retarget(uint32_t owner, float targetValue) {
+    if (!contains(owner)) {
+        return false;
+    }
+    uint32_t slot = slotOfOwner[owner];
+    lanes[slot >> LANE_SHIFT].target[slot & POSITION_MASK] = targetValue;
+    return true;
+}
+
+bool AnimationPool::remove(uint32_t owner) {
+    if (!contains(owner)) {
+        return false;
+    }
+    uint32_t slot = slotOfOwner[owner];
+    removeAt(static_cast<uint8_t>(slot >> LANE_SHIFT), slot & POSITION_MASK);
+    return true;
+}
+
+void AnimationPool::moveOwner(uint32_t from, uint32_t to) {
+    if (from == to || !contains(from)) {
+        return;
+    }
+    if (to >= slotOfOwner.size()) {
+        slotOfOwner.resize(static_cast<size_t>(to) + 1, INVALID_SLOT);
+    }
+
+    uint32_t slot = slotOfOwner[from];
+    slotOfOwner[from] = INVALID_SLOT;
+    slotOfOwner[to] = slot;
+    lanes[slot >> LANE_SHIFT].owner[slot & POSITION_MASK] = to;
+}
+
+void AnimationPool::clear() {
+    for (Lane& lane : lanes) {
+        lane.count = 0;
+        lane.owner.clear();
+    }
+    slotOfOwner.clear();
+    activeCount = 0;
+}
+
+bool AnimationPool::getState(uint32_t owner, State& out) const {
+    if (!contains(owner)) {
+        return false;
+    }
+    uint32_t slot = slotOfOwner[owner];
+    const Lane& lane = lanes[slot >> LANE_SHIFT];
+    uint32_t position = slot & POSITION_MASK;
+
+    out.start = lane.start[position];
+    out.target = lane.target[position];
+    out.progress = lane.progress[position];
+    out.duration = 1.0f / lane.rate[position];
+    out.curve = static_cast<EasingCurve>(slot >> LANE_SHIFT);
+    return true;
+}
+
+void AnimationPool::advance(float deltaTime) {
+    advanceLane<EasingCurve::Default>(lanes[static_cast<uint32_t>(EasingCurve::Default)], deltaTime);
+    advanceLane<EasingCurve::Surge>(lanes[static_cast<uint32_t>(EasingCurve::Surge)], deltaTime);
+    advanceLane<EasingCurve::Crash>(lanes[static_cast<uint32_t>(EasingCurve::Crash)], deltaTime);
+}
+
+template<EasingCurve Curve>
+void AnimationPool::advanceLane(Lane& lane, float deltaTime) {
+    using Ease = Easing<Curve>;
+
+    const float* starts = lane.start.data();
+    const float* targets = lane.target.data();
+    const float* rates = lane.rate.data();
+    float* progress = lane.progress.data();
+    float* values = lane.value.data();
+
+    if constexpr (Ease::Vectorized) {
+        const simd::Float dt(deltaTime);
+        const simd::Float one(1.0f);
+
+        // The last step may run into padding; those lanes are never read back
+        for (uint32_t i = 0; i < lane.count; i += simd::Float::Width) {
+            simd::Float t = min(fma(simd::Float::load(rates + i), dt, simd::Float::load(progress + i)), one);
+            t.store(progress + i);
+
+            simd::Float from = simd::Float::load(starts + i);
+            fma(simd::Float::load(targets + i) - from, Ease::apply(t), from).store(values + i);
+        }
+    } else {
+        for (uint32_t i = 0; i < lane.count; ++i) {
+            float t = std::min(progress[i] + rates[i] * deltaTime, 1.0f);
+            progress[i] = t;
+            values[i] = starts[i] + (targets[i] - starts[i]) * Ease::apply(t);
+        }
+    }
+}
+
+void AnimationPool::removeAt(uint8_t curve, uint32_t position) {
+    Lane& lane = lanes[curve];
+    uint32_t last = lane.count - 1;
+
+    slotOfOwner[lane.owner[position]] = INVALID_SLOT;
+    if (position != last) {
+        lane.owner[position] = lane.owner[last];
+        lane.start[position] = lane.start[last];
+        lane.target[position] = lane.target[last];
+        lane.progress[position] = lane.progress[last];
+        lane.rate[position] = lane.rate[last];
+        lane.value[position] = lane.value[last];
+        slotOfOwner[lane.owner[position]] = (static_cast<uint32_t>(curve) << LANE_SHIFT) | position;
+    }
+
+    lane.owner.pop_back();
+    lane.count = last;
+    --activeCount;
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Easing curve of a pooled animation (fixed when the animation starts)
+ */
+enum class EasingCurve : uint8_t {
+    Default = 0,    // AnimationUtils::defaultHeightEasing (in-out cubic)
+    Surge = 1,      // AnimationUtils::surgeEasing (elastic overshoot)
+    Crash = 2,      // AnimationUtils::crashEasing (in cubic)
+    Count = 3
+};
+
+/**
+ * @brief Dense pool of running scalar animations (start -> target over a duration)
+ *
+ * Each animation belongs to an owner index (a BuildingStore dense index).
+ * Animations are grouped by easing curve into structure-of-arrays lanes packed
+ * densely in [0, count): adding appends, removing swap-removes with the last
+ * entry of the lane, and an owner -> slot table makes both O(1). update()
+ * advances each lane in one pass with its curve fixed at compile time, so the
+ * polynomial curves run on simd::Float without per-entry branching.
+ */
+class AnimationPool {
+public:
+    /**
+     * @brief Snapshot of one running animation
+     */
+    struct State {
+        float start = 0.0f;
+        float target = 0.0f;
+        float progress = 0.0f;      // 0.0 to 1.0
+        float duration = 1.0f;      // Seconds
+        EasingCurve curve = EasingCurve::Default;
+    };
+
+    /**
+     * @brief Start (or restart) the animation of an owner
+     * @param owner Owner index
+     * @param startValue Value at progress 0
+     * @param targetValue Value at progress 1
+     * @param duration Length in seconds (> 0)
+     * @param curve Easing curve
+     */
+    void start(uint32_t owner, float startValue, float targetValue, float duration, EasingCurve curve);
+
+    /**
+     * @brief Resume an animation part-way (snapshot restore)
+     * @param owner Owner index
+     * @param state Saved state (progress in [0, 1))
+     */
+    void resume(uint32_t owner, const State& state);
+
+    /**
+     * @brief Change where a running animation ends without restarting it
+     * @return False if the owner is not animating
+     */
+    bool retarget(uint32_t owner, float targetValue);
+
+    /**
+     * @brief Stop an owner's animation where it is
+     * @return False if the owner was not animating
+     */
+    bool remove(uint32_t owner);
+
+    /**
+     * @brief Re-key an animation after its owner moved to a new index
+     *
+     * Call after removing the destination's own animation (a swap-remove in
+     * the owner's container moves its last element into the freed index).
+     */
+    void moveOwner(uint32_t from, uint32_t to);
+
+    /**
+     * @brief Drop every animation (keeps capacity)
+     */
+    void clear();
+
+    bool contains(uint32_t owner) const {
+        return owner < slotOfOwner.size() && slotOfOwner[owner] != INVALID_SLOT;
+    }
+
+    /**
+     * @brief Read a running animation
+     * @return False if the owner is not animating
+     */
+    bool getState(uint32_t owner, State& out) const;
+
+    /**
+     * @brief Visit every running animation as fn(owner, State)
+     */
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        for (uint8_t curve = 0; curve < LANE_COUNT; ++curve) {
+            const Lane& lane = lanes[curve];
+            for (uint32_t i = 0; i < lane.count; ++i) {
+                State state;
+                state.start = lane.start[i];
+                state.target = lane.target[i];
+                state.progress = lane.progress[i];
+                state.duration = 1.0f / lane.rate[i];
+                state.curve = static_cast<EasingCurve>(curve);
+                fn(lane.owner[i], state);
+            }
+        }
+    }
+
+    size_t size() const { return activeCount; }
+    bool empty() const { return activeCount == 0; }
+
+    /**
+     * @brief Advance every animation and write its eased value
+     * @param deltaTime Time since last update (seconds)
+     * @param values Indexed by owner; receives the eased value (the exact
+     *        target for animations that finish this step)
+     * @param onFinish Called with the owner of each finished animation, after
+     *        it has been removed from the pool
+     */
+    template<typename OnFinish>
+    void update(float deltaTime, std::span<float> values, OnFinish&& onFinish) {
+        advance(deltaTime);
+
+        for (uint8_t curve = 0; curve < LANE_COUNT; ++curve) {
+            Lane& lane = lanes[curve];
+            for (uint32_t i = 0; i < lane.count;) {
+                uint32_t owner = lane.owner[i];
+                if (lane.progress[i] >= 1.0f) {
+                    values[owner] = lane.target[i];
+                    removeAt(curve, i);
+                    onFinish(owner);
+                    continue;
+                }
+                values[owner] = lane.value[i];
+                ++i;
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t LANE_COUNT = static_cast<uint32_t>(EasingCurve::Count);
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+    static constexpr uint32_t LANE_SHIFT = 30;                      // Slot = lane << 30 | position
+    static constexpr uint32_t POSITION_MASK = (1u << LANE_SHIFT) - 1;
+
+    /**
+     * @brief Animations sharing one easing curve
+     *
+     * Float streams are padded to simd::padCount(count) so the vector loop
+     * needs no scalar tail.
+     */
+    struct Lane {
+        uint32_t count = 0;
+        std::vector<uint32_t> owner;
+        std::vector<float> start;
+        std::vector<float> target;
+        std::vector<float> progress;
+        std::vector<float> rate;        // 1 / duration
+        std::vector<float> value;       // Eased value from the last advance()
+    };
+
+    /**
+     * @brief Advance progress and evaluate eased values in every lane
+     */
+    void advance(float deltaTime);
+
+    /**
+     * @brief Advance one lane with its curve known at compile time
+     */
+    template<EasingCurve Curve>
+    void advanceLane(Lane& lane, float deltaTime);
+
+    /**
+     * @brief Swap-remove the entry at a lane position and patch the moved entry's slot
+     */
+    void removeAt(uint8_t curve, uint32_t position);
+
+    std::array<Lane, LANE_COUNT> lanes;
+    std::vector<uint32_t> slotOfOwner;     // Owner -> slot (INVALID_SLOT = not animating)
+    size_t activeCount = 0;
+};
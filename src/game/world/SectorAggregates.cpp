@@ -0,0 +1,237 @@
+#include "SectorAggregates.hpp"
+
+// ============================================================================
+// RankHeap
+// ============================================================================
+
+template<bool MaxHeap>
+void SectorAggregates::RankHeap<MaxHeap>::place(uint32_t position, const HeapEntry& entry,
+                                                std::vector<uint32_t>& positions) {
+    entries[position] = entry;
+    positions[entry.owner] = position;
+}
+
+template<bool MaxHeap>
+void SectorAggregates::RankHeap<MaxHeap>::siftUp(uint32_t position, std::vector<uint32_t>& positions) {
+    HeapEntry entry = entries[position];
+    while (position > 0) {
+        uint32_t parent = (position - 1) / 2;
+        if (!above(entry.key, entries[parent].key)) {
+            break;
+        }
+        place(position, entries[parent], positions);
+        position = parent;
+    }
+    place(position, entry, positions);
+}
+
+template<bool MaxHeap>
+void SectorAggregates::RankHeap<MaxHeap>::siftDown(uint32_t position, std::vector<uint32_t>& positions) {
+    HeapEntry entry = entries[position];
+    const uint32_t count = static_cast<uint32_t>(entries.size());
+    while (true) {
+        uint32_t child = position * 2 + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && above(entries[child + 1].key, entries[child].key)) {
+            ++child;
+        }
+        if (!above(entries[child].key, entry.key)) {
+            break;
+        }
+        place(position, entries[child], positions);
+        position = child;
+    }
+    place(position, entry, positions);
+}
+
+template<bool MaxHeap>
+void SectorAggregates::RankHeap<MaxHeap>::push(uint32_t owner, float key, std::vector<uint32_t>& positions) {
+    entries.push_back(HeapEntry{key, owner});
+    siftUp(static_cast<uint32_t>(entries.size() - 1), positions);
+}
+
+template<bool MaxHeap>
+void SectorAggregates::RankHeap<MaxHeap>::update(uint32_t owner, float key, std::vector<uint32_t>& positions) {
+    uint32_t position = positions[owner];
+    float previous = entries[position].key;
+    entries[position].key = key;
+    if (above(key, previous)) {
+        siftUp(position, positions);
+    } else {
+        siftDown(position, positions);
+    }
+}
+
+template<bool MaxHeap>
+void SectorAggregates::RankHeap<MaxHeap>::erase(uint32_t owner, std::vector<uint32_t>& positions) {
+    uint32_t position = positions[owner];
+    HeapEntry last = entries.back();
+    entries.pop_back();
+    if (position == entries.size()) {
+        return;     // Removed the last entry
+    }
+
+    // Move the last entry into the hole and restore order in whichever direction it broke
+    place(position, last, positions);
+    if (position > 0 && above(last.key, entries[(position - 1) / 2].key)) {
+        siftUp(position, positions);
+    } else {
+        siftDown(position, positions);
+    }
+}
+
+template struct SectorAggregates::RankHeap<true>;
+template struct SectorAggregates::RankHeap<false>;
+
+// ============================================================================
+// SectorAggregates
+// ============================================================================
+
+uint32_t SectorAggregates::findOrAddSector(const std::string& sectorId) {
+    auto it = sectorIndex.find(sectorId);
+    if (it != sectorIndex.end()) {
+        return it->second;
+    }
+
+    uint32_t index = static_cast<uint32_t>(sectors.size());
+    sectors.emplace_back().id = sectorId;
+    sectorIndex.emplace(sectorId, index);
+    ++version;
+    return index;
+}
+
+uint32_t SectorAggregates::findSector(const std::string& sectorId) const {
+    auto it = sectorIndex.find(sectorId);
+    return it != sectorIndex.end() ? it->second : INVALID_SECTOR;
+}
+
+void SectorAggregates::accumulate(Sector& sector, const SectorSample& sample, double sign) {
+    sector.priceSum += sign * sample.price;
+    sector.changeSum += sign * sample.changePercent;
+    sector.volumeSum += sign * sample.volume;
+    sector.volumeChangeSum += sign * static_cast<double>(sample.volume) * sample.changePercent;
+
+    uint32_t* counter = sample.changePercent > 0.0f ? &sector.advancers
+                      : sample.changePercent < 0.0f ? &sector.decliners
+                      : nullptr;
+    if (counter) {
+        *counter = sign > 0.0 ? *counter + 1 : *counter - 1;
+    }
+}
+
+void SectorAggregates::add(uint32_t sectorIndex, uint32_t owner, const SectorSample& sample, const glm::vec3& position) {
+    if (owner >= ownerSector.size()) {
+        size_t size = static_cast<size_t>(owner) + 1;
+        ownerSector.resize(size, INVALID_SECTOR);
+        gainerPositions.resize(size, 0);
+        loserPositions.resize(size, 0);
+    }
+    ownerSector[owner] = sectorIndex;
+
+    Sector& sector = sectors[sectorIndex];
+    glm::vec2 xz(position.x, position.z);
+    if (sector.buildingCount == 0) {
+        sector.boundsMin = xz;
+        sector.boundsMax = xz;
+    } else {
+        sector.boundsMin = glm::min(sector.boundsMin, xz);
+        sector.boundsMax = glm::max(sector.boundsMax, xz);
+    }
+
+    ++sector.buildingCount;
+    accumulate(sector, sample, 1.0);
+    sector.gainers.push(owner, sample.changePercent, gainerPositions);
+    sector.losers.push(owner, sample.changePercent, loserPositions);
+    ++version;
+}
+
+void SectorAggregates::update(uint32_t owner, const SectorSample& before, const SectorSample& after) {
+    uint32_t sectorIndex = getOwnerSector(owner);
+    if (sectorIndex == INVALID_SECTOR) {
+        return;
+    }
+
+    Sector& sector = sectors[sectorIndex];
+    accumulate(sector, before, -1.0);
+    accumulate(sector, after, 1.0);
+    if (after.changePercent != before.changePercent) {
+        sector.gainers.update(owner, after.changePercent, gainerPositions);
+        sector.losers.update(owner, after.changePercent, loserPositions);
+    }
+    ++version;
+}
+
+void SectorAggregates::remove(uint32_t owner, const SectorSample& sample) {
+    uint32_t sectorIndex = getOwnerSector(owner);
+    if (sectorIndex == INVALID_SECTOR) {
+        return;
+    }
+
+    Sector& sector = sectors[sectorIndex];
+    --sector.buildingCount;
+    accumulate(sector, sample, -1.0);
+    sector.gainers.erase(owner, gainerPositions);
+    sector.losers.erase(owner, loserPositions);
+    ownerSector[owner] = INVALID_SECTOR;
+
+    // Snap sums back to exact zero once the sector empties
+    if (sector.buildingCount == 0) {
+        sector.priceSum = sector.changeSum = sector.volumeSum = sector.volumeChangeSum = 0.0;
+    }
+    ++version;
+}
+
+void SectorAggregates::moveOwner(uint32_t from, uint32_t to) {
+    uint32_t sectorIndex = getOwnerSector(from);
+    if (from == to || sectorIndex == INVALID_SECTOR) {
+        return;
+    }
+
+    Sector& sector = sectors[sectorIndex];
+    sector.gainers.entries[gainerPositions[from]].owner = to;
+    sector.losers.entries[loserPositions[from]].owner = to;
+    gainerPositions[to] = gainerPositions[from];
+    loserPositions[to] = loserPositions[from];
+    ownerSector[to] = sectorIndex;
+    ownerSector[from] = INVALID_SECTOR;
+}
+
+void SectorAggregates::clear() {
+    sectors.clear();
+    sectorIndex.clear();
+    gainerPositions.clear();
+    loserPositions.clear();
+    ownerSector.clear();
+    ++version;
+}
+
+SectorSummary SectorAggregates::getSummary(uint32_t sectorIndex) const {
+    const Sector& sector = sectors[sectorIndex];
+    SectorSummary summary;
+    summary.buildingCount = sector.buildingCount;
+    summary.advancers = sector.advancers;
+    summary.decliners = sector.decliners;
+    summary.unchanged = sector.buildingCount - sector.advancers - sector.decliners;
+    summary.totalVolume = sector.volumeSum;
+    summary.boundsMin = sector.boundsMin;
+    summary.boundsMax = sector.boundsMax;
+
+    if (sector.buildingCount > 0) {
+        double count = static_cast<double>(sector.buildingCount);
+        summary.averagePrice = static_cast<float>(sector.priceSum / count);
+        summary.averageChangePercent = static_cast<float>(sector.changeSum / count);
+        summary.volumeWeightedChangePercent = sector.volumeSum > 0.0
+            ? static_cast<float>(sector.volumeChangeSum / sector.volumeSum)
+            : summary.averageChangePercent;
+
+        const HeapEntry& gainer = sector.gainers.entries.front();
+        const HeapEntry& loser = sector.losers.entries.front();
+        summary.topGainer = gainer.owner;
+        summary.topGainerChangePercent = gainer.key;
+        summary.topLoser = loser.owner;
+        summary.topLoserChangePercent = loser.key;
+    }
+    return summary;
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Market state of one building as seen by sector aggregates
+ */
+struct SectorSample {
+    float price = 0.0f;
+    float changePercent = 0.0f;
+    float volume = 0.0f;            // Traded volume (weights changePercent)
+};
+
+/**
+ * @brief Derived per-sector statistics (see SectorAggregates::getSummary)
+ */
+struct SectorSummary {
+    uint32_t buildingCount = 0;
+    float averagePrice = 0.0f;
+    float averageChangePercent = 0.0f;
+    float volumeWeightedChangePercent = 0.0f;   // Equal to the average while no volume traded
+    double totalVolume = 0.0;
+    uint32_t advancers = 0;                     // changePercent > 0
+    uint32_t decliners = 0;                     // changePercent < 0
+    uint32_t unchanged = 0;
+    uint32_t topGainer = 0xFFFFFFFFu;           // Owner index (INVALID_OWNER if empty)
+    uint32_t topLoser = 0xFFFFFFFFu;
+    float topGainerChangePercent = 0.0f;
+    float topLoserChangePercent = 0.0f;
+    glm::vec2 boundsMin{0.0f};                  // XZ extent of the sector's buildings (grow-only)
+    glm::vec2 boundsMax{0.0f};
+};
+
+/**
+ * @brief Running per-sector market aggregates
+ *
+ * Buildings (owners, keyed by BuildingStore dense index) report their
+ * samples on add, every price update and removal; each call adjusts sums
+ * and counters in O(1) and two indexed heaps (top gainer / top loser) in
+ * O(log n). Reading a summary never scans buildings.
+ *
+ * Sums are kept in double so long runs of add/subtract stay accurate to
+ * well below display precision.
+ */
+class SectorAggregates {
+public:
+    static constexpr uint32_t INVALID_OWNER = 0xFFFFFFFFu;
+    static constexpr uint32_t INVALID_SECTOR = 0xFFFFFFFFu;
+
+    /**
+     * @brief Index of a sector, registering it on first use
+     */
+    uint32_t findOrAddSector(const std::string& sectorId);
+
+    /**
+     * @brief Index of a sector (INVALID_SECTOR if unknown)
+     */
+    uint32_t findSector(const std::string& sectorId) const;
+
+    size_t getSectorCount() const { return sectors.size(); }
+    const std::string& getSectorId(uint32_t sector) const { return sectors[sector].id; }
+
+    /**
+     * @brief Add a building to a sector
+     * @param position World position (grows the sector bounds)
+     */
+    void add(uint32_t sector, uint32_t owner, const SectorSample& sample, const glm::vec3& position);
+
+    /**
+     * @brief Replace a building's contribution after a price update
+     */
+    void update(uint32_t owner, const SectorSample& before, const SectorSample& after);
+
+    /**
+     * @brief Remove a building (sample = its current contribution)
+     */
+    void remove(uint32_t owner, const SectorSample& sample);
+
+    /**
+     * @brief Sector of a building (INVALID_SECTOR if not added)
+     */
+    uint32_t getOwnerSector(uint32_t owner) const {
+        return owner < ownerSector.size() ? ownerSector[owner] : INVALID_SECTOR;
+    }
+
+    /**
+     * @brief Re-key a building after its owner index changed (store swap-remove)
+     */
+    void moveOwner(uint32_t from, uint32_t to);
+
+    /**
+     * @brief Forget every sector and building
+     */
+    void clear();
+
+    SectorSummary getSummary(uint32_t sector) const;
+
+    /**
+     * @brief Incremented by every change (for consumers that cache summaries)
+     */
+    uint64_t getVersion() const { return version; }
+
+private:
+    struct HeapEntry {
+        float key;
+        uint32_t owner;
+    };
+
+    /**
+     * @brief Binary heap with owner -> position back-references (MaxHeap: largest key on top)
+     */
+    template<bool MaxHeap>
+    struct RankHeap {
+        std::vector<HeapEntry> entries;
+
+        static bool above(float a, float b) { return MaxHeap ? a > b : a < b; }
+
+        void push(uint32_t owner, float key, std::vector<uint32_t>& positions);
+        void update(uint32_t owner, float key, std::vector<uint32_t>& positions);
+        void erase(uint32_t owner, std::vector<uint32_t>& positions);
+
+    private:
+        void place(uint32_t position, const HeapEntry& entry, std::vector<uint32_t>& positions);
+        void siftUp(uint32_t position, std::vector<uint32_t>& positions);
+        void siftDown(uint32_t position, std::vector<uint32_t>& positions);
+    };
+
+    struct Sector {
+        std::string id;
+        uint32_t buildingCount = 0;
+        double priceSum = 0.0;
+        double changeSum = 0.0;
+        double volumeSum = 0.0;
+        double volumeChangeSum = 0.0;           // Sum of volume * changePercent
+        uint32_t advancers = 0;
+        uint32_t decliners = 0;
+        RankHeap<true> gainers;
+        RankHeap<false> losers;
+        glm::vec2 boundsMin{0.0f};
+        glm::vec2 boundsMax{0.0f};
+    };
+
+    void accumulate(Sector& sector, const SectorSample& sample, double sign);
+
+    std::vector<Sector> sectors;
+    std::unordered_map<std::string, uint32_t> sectorIndex;
+    std::vector<uint32_t> gainerPositions;      // Owner -> position in its sector's gainers heap
+    std::vector<uint32_t> loserPositions;       // Owner -> position in its sector's losers heap
+    std::vector<uint32_t> ownerSector;          // Owner -> sector
+    uint64_t version = 0;
+};
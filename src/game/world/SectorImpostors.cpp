@@ -0,0 +1,174 @@
+#include "SectorImpostors.hpp"
+#include "src/game/entities/BuildingEntity.hpp"
+#include <algorithm>
+#include <cmath>
+
+uint64_t SectorImpostors::cellKey(uint32_t sector, int32_t x, int32_t z) {
+    // 16 bits of sector, 24 bits per cell coordinate (+/-536 km at 64 m cells)
+    return (static_cast<uint64_t>(sector & 0xFFFFu) << 48)
+         | (static_cast<uint64_t>(static_cast<uint32_t>(x) & 0xFFFFFFu) << 24)
+         | (static_cast<uint64_t>(static_cast<uint32_t>(z) & 0xFFFFFFu));
+}
+
+void SectorImpostors::add(uint32_t owner, uint32_t sector, const glm::vec3& position, const glm::vec2& footprint,
+                          float height, float changePercent) {
+    if (sector >= sectors.size()) {
+        sectors.resize(static_cast<size_t>(sector) + 1);
+    }
+    if (owner >= ownerCell.size()) {
+        size_t size = static_cast<size_t>(owner) + 1;
+        ownerCell.resize(size, INVALID_CELL);
+        ownerHeight.resize(size, 0.0f);
+        ownerChange.resize(size, 0.0f);
+    }
+
+    int32_t x = static_cast<int32_t>(std::floor(position.x / CELL_SIZE));
+    int32_t z = static_cast<int32_t>(std::floor(position.z / CELL_SIZE));
+    auto [it, inserted] = cellIndex.try_emplace(cellKey(sector, x, z), static_cast<uint32_t>(cells.size()));
+    if (inserted) {
+        Cell& cell = cells.emplace_back();
+        cell.sector = sector;
+        cell.baseY = position.y;
+        sectors[sector].cells.push_back(it->second);
+    }
+
+    uint32_t index = it->second;
+    Cell& cell = cells[index];
+    glm::vec2 center(position.x, position.z);
+    glm::vec2 lo = center - footprint * 0.5f;
+    glm::vec2 hi = center + footprint * 0.5f;
+    if (inserted) {
+        cell.footprintMin = lo;
+        cell.footprintMax = hi;
+    } else {
+        cell.footprintMin = glm::min(cell.footprintMin, lo);
+        cell.footprintMax = glm::max(cell.footprintMax, hi);
+    }
+    ++cell.count;
+    cell.heightSum += height;
+    cell.changeSum += changePercent;
+
+    Sector& s = sectors[sector];
+    if (!s.hasBounds) {
+        s.boundsMin = lo;
+        s.boundsMax = hi;
+        s.hasBounds = true;
+    } else {
+        s.boundsMin = glm::min(s.boundsMin, lo);
+        s.boundsMax = glm::max(s.boundsMax, hi);
+    }
+
+    ownerCell[owner] = index;
+    ownerHeight[owner] = height;
+    ownerChange[owner] = changePercent;
+}
+
+void SectorImpostors::update(uint32_t owner, float height, float changePercent) {
+    if (owner >= ownerCell.size() || ownerCell[owner] == INVALID_CELL) {
+        return;
+    }
+
+    Cell& cell = cells[ownerCell[owner]];
+    cell.heightSum += static_cast<double>(height) - ownerHeight[owner];
+    cell.changeSum += static_cast<double>(changePercent) - ownerChange[owner];
+    ownerHeight[owner] = height;
+    ownerChange[owner] = changePercent;
+}
+
+void SectorImpostors::remove(uint32_t owner) {
+    if (owner >= ownerCell.size() || ownerCell[owner] == INVALID_CELL) {
+        return;
+    }
+
+    Cell& cell = cells[ownerCell[owner]];
+    --cell.count;
+    cell.heightSum -= ownerHeight[owner];
+    cell.changeSum -= ownerChange[owner];
+    if (cell.count == 0) {
+        cell.heightSum = cell.changeSum = 0.0;  // Drop accumulated rounding
+    }
+    ownerCell[owner] = INVALID_CELL;
+}
+
+void SectorImpostors::moveOwner(uint32_t from, uint32_t to) {
+    if (from == to || from >= ownerCell.size() || ownerCell[from] == INVALID_CELL) {
+        return;
+    }
+
+    ownerCell[to] = ownerCell[from];
+    ownerHeight[to] = ownerHeight[from];
+    ownerChange[to] = ownerChange[from];
+    ownerCell[from] = INVALID_CELL;
+}
+
+void SectorImpostors::clear() {
+    cells.clear();
+    sectors.clear();
+    cellIndex.clear();
+    ownerCell.clear();
+    ownerHeight.clear();
+    ownerChange.clear();
+    impostorSectorCount = 0;
+}
+
+bool SectorImpostors::updateLod(const glm::vec3& viewerPosition) {
+    bool changed = false;
+    impostorSectorCount = 0;
+
+    for (Sector& sector : sectors) {
+        bool impostor = false;
+        if (distance > 0.0f && sector.hasBounds) {
+            // Distance from the viewer to the sector's ground rectangle
+            glm::vec2 viewer(viewerPosition.x, viewerPosition.z);
+            glm::vec2 offset = glm::max(glm::max(sector.boundsMin - viewer, viewer - sector.boundsMax), glm::vec2(0.0f));
+            float distanceSq = glm::dot(offset, offset) + viewerPosition.y * viewerPosition.y;
+
+            float threshold = sector.impostor ? distance * HYSTERESIS : distance;
+            impostor = distanceSq > threshold * threshold;
+        }
+
+        changed |= impostor != sector.impostor;
+        sector.impostor = impostor;
+        impostorSectorCount += impostor ? 1 : 0;
+    }
+    return changed;
+}
+
+size_t SectorImpostors::appendObjects(std::vector<rendering::ObjectData>& out) const {
+    size_t appended = 0;
+    for (const Sector& sector : sectors) {
+        if (!sector.impostor) {
+            continue;
+        }
+
+        for (uint32_t index : sector.cells) {
+            const Cell& cell = cells[index];
+            if (cell.count == 0) {
+                continue;
+            }
+
+            float count = static_cast<float>(cell.count);
+            float height = std::max(static_cast<float>(cell.heightSum / count), 0.0f);
+            float changePercent = static_cast<float>(cell.changeSum / count);
+            glm::vec2 center = (cell.footprintMin + cell.footprintMax) * 0.5f;
+            glm::vec2 size = cell.footprintMax - cell.footprintMin;
+
+            // Same unit-cube convention as building instances
+            rendering::ObjectData& obj = out.emplace_back();
+            obj.worldMatrix = glm::mat4(
+                size.x, 0.0f,   0.0f,   0.0f,
+                0.0f,   height, 0.0f,   0.0f,
+                0.0f,   0.0f,   size.y, 0.0f,
+                center.x, cell.baseY, center.y, 1.0f
+            );
+            obj.boundingBoxMin = glm::vec4(cell.footprintMin.x, cell.baseY, cell.footprintMin.y, 0.0f);
+            obj.boundingBoxMax = glm::vec4(cell.footprintMax.x, cell.baseY + height, cell.footprintMax.y, 0.0f);
+
+            glm::vec4 color = BuildingEntity::colorForPriceChange(changePercent);
+            obj.colorAndMetallic = glm::vec4(color.r, color.g, color.b, 0.3f);
+            obj.roughnessAOPad = glm::vec4(0.6f, 1.0f, 0.0f, 0.0f);     // Rougher than buildings: no fake glints
+            ++appended;
+        }
+    }
+    return appended;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "src/rendering/InstancedRenderData.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Coarse stand-ins for distant sectors
+ *
+ * Every building also belongs to a square impostor cell of its sector (a
+ * world-aligned grid of CELL_SIZE meters). Each cell keeps the running sum
+ * of its buildings' target heights and price changes, adjusted in O(1) on
+ * add, update and removal, so a cell's box (mean height over the members'
+ * footprint, colored by mean change) is always current without a scan.
+ *
+ * A sector switches to its cells when the viewer is farther than the
+ * impostor distance from its bounds, and back to individual buildings only
+ * once closer than HYSTERESIS times that distance, so hovering around the
+ * threshold does not flip it every frame. Sectors use SectorAggregates
+ * indices; owners are BuildingStore dense indices.
+ */
+class SectorImpostors {
+public:
+    static constexpr float CELL_SIZE = 64.0f;           // Impostor cell edge in meters
+    static constexpr float DEFAULT_DISTANCE = 600.0f;   // Viewer distance at which sectors switch
+    static constexpr float HYSTERESIS = 0.8f;           // Switch back below this fraction of the distance
+
+    /**
+     * @brief Add a building
+     * @param footprint Base width (x) and depth (z)
+     * @param height Target height
+     * @param changePercent Price change
+     */
+    void add(uint32_t owner, uint32_t sector, const glm::vec3& position, const glm::vec2& footprint,
+             float height, float changePercent);
+
+    /**
+     * @brief Replace a building's height and price change
+     */
+    void update(uint32_t owner, float height, float changePercent);
+
+    /**
+     * @brief Remove a building
+     */
+    void remove(uint32_t owner);
+
+    /**
+     * @brief Re-key a building after its owner index changed (store swap-remove)
+     */
+    void moveOwner(uint32_t from, uint32_t to);
+
+    /**
+     * @brief Forget every building, cell and sector
+     */
+    void clear();
+
+    /**
+     * @brief Re-evaluate every sector's representation for a viewer position
+     * @return True if any sector switched
+     */
+    bool updateLod(const glm::vec3& viewerPosition);
+
+    /**
+     * @brief Set the switch distance (0 disables impostors)
+     */
+    void setDistance(float newDistance) { distance = newDistance; }
+    float getDistance() const { return distance; }
+
+    /**
+     * @brief True if the sector is drawn as impostor cells
+     */
+    bool isImpostor(uint32_t sector) const {
+        return sector < sectors.size() && sectors[sector].impostor;
+    }
+
+    /**
+     * @brief True if the building's sector is drawn as impostor cells
+     */
+    bool isOwnerHidden(uint32_t owner) const {
+        return owner < ownerCell.size() && ownerCell[owner] != INVALID_CELL
+            && sectors[cells[ownerCell[owner]].sector].impostor;
+    }
+
+    size_t getImpostorSectorCount() const { return impostorSectorCount; }
+
+    /**
+     * @brief Append one box per non-empty cell of every impostor sector
+     * @return Number of objects appended
+     */
+    size_t appendObjects(std::vector<rendering::ObjectData>& out) const;
+
+private:
+    static constexpr uint32_t INVALID_CELL = 0xFFFFFFFFu;
+
+    struct Cell {
+        uint32_t sector = 0;
+        uint32_t count = 0;
+        double heightSum = 0.0;
+        double changeSum = 0.0;
+        glm::vec2 footprintMin{0.0f};   // XZ extent of member footprints (grow-only)
+        glm::vec2 footprintMax{0.0f};
+        float baseY = 0.0f;
+    };
+
+    struct Sector {
+        bool impostor = false;
+        bool hasBounds = false;
+        glm::vec2 boundsMin{0.0f};       // XZ extent of member footprints (grow-only)
+        glm::vec2 boundsMax{0.0f};
+        std::vector<uint32_t> cells;    // Indices into cells
+    };
+
+    static uint64_t cellKey(uint32_t sector, int32_t x, int32_t z);
+
+    std::vector<Cell> cells;
+    std::vector<Sector> sectors;
+    std::unordered_map<uint64_t, uint32_t> cellIndex;   // cellKey -> index into cells
+    std::vector<uint32_t> ownerCell;                    // Owner -> cell
+    std::vector<float> ownerHeight;                     // Owner -> height in its cell's sum
+    std::vector<float> ownerChange;                     // Owner -> change in its cell's sum
+    float distance = DEFAULT_DISTANCE;
+    size_t impostorSectorCount = 0;
+};
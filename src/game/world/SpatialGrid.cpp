@@ -0,0 +1,239 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Keeps cell loops clear of int32 overflow for far-out positions
+constexpr float MAX_CELL_COORD = 1073741824.0f;     // 2^30
+
+} // anonymous namespace
+
+SpatialGrid::SpatialGrid(float initialCellSize)
+    : cellSize(initialCellSize)
+    , inverseCellSize(1.0f / initialCellSize)
+{
+}
+
+void SpatialGrid::setCellSize(float newCellSize) {
+    if (newCellSize <= 0.0f || newCellSize == cellSize) {
+        return;
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve(entryCount);
+    for (const auto& [key, cell] : cells) {
+        entries.insert(entries.end(), cell.begin(), cell.end());
+    }
+
+    clear();
+    cellSize = newCellSize;
+    inverseCellSize = 1.0f / newCellSize;
+    for (const Entry& entry : entries) {
+        insert(entry.id, entry.position);
+    }
+}
+
+int32_t SpatialGrid::cellCoord(float value) const {
+    return static_cast<int32_t>(std::clamp(std::floor(value * inverseCellSize), -MAX_CELL_COORD, MAX_CELL_COORD));
+}
+
+const std::vector<SpatialGrid::Entry>* SpatialGrid::findCell(int32_t x, int32_t z) const {
+    auto it = cells.find(cellKey(x, z));
+    return it != cells.end() ? &it->second : nullptr;
+}
+
+void SpatialGrid::insert(uint64_t id, const glm::vec3& position) {
+    int32_t x = cellCoord(position.x);
+    int32_t z = cellCoord(position.z);
+    cells[cellKey(x, z)].push_back(Entry{position, id});
+
+    if (entryCount == 0 && maxCellX < minCellX) {
+        minCellX = maxCellX = x;
+        minCellZ = maxCellZ = z;
+    } else {
+        minCellX = std::min(minCellX, x);
+        maxCellX = std::max(maxCellX, x);
+        minCellZ = std::min(minCellZ, z);
+        maxCellZ = std::max(maxCellZ, z);
+    }
+    ++entryCount;
+}
+
+bool SpatialGrid::remove(uint64_t id, const glm::vec3& position) {
+    auto it = cells.find(cellKey(cellCoord(position.x), cellCoord(position.z)));
+    if (it == cells.end()) {
+        return false;
+    }
+
+    std::vector<Entry>& cell = it->second;
+    auto entry = std::find_if(cell.begin(), cell.end(), [id](const Entry& e) { return e.id == id; });
+    if (entry == cell.end()) {
+        return false;
+    }
+
+    // Cells hold a handful of entries: swap-remove
+    *entry = cell.back();
+    cell.pop_back();
+    if (cell.empty()) {
+        cells.erase(it);    // Only occupied cells stay in the map
+    }
+    --entryCount;
+    return true;
+}
+
+void SpatialGrid::clear() {
+    cells.clear();
+    entryCount = 0;
+    minCellX = minCellZ = 0;
+    maxCellX = maxCellZ = -1;
+}
+
+size_t SpatialGrid::queryRadius(const glm::vec3& center, float radius, std::span<uint64_t> out) const {
+    if (entryCount == 0 || radius < 0.0f) {
+        return 0;
+    }
+
+    int32_t x0 = std::max(cellCoord(center.x - radius), minCellX);
+    int32_t x1 = std::min(cellCoord(center.x + radius), maxCellX);
+    int32_t z0 = std::max(cellCoord(center.z - radius), minCellZ);
+    int32_t z1 = std::min(cellCoord(center.z + radius), maxCellZ);
+    if (x0 > x1 || z0 > z1) {
+        return 0;
+    }
+
+    const float radiusSq = radius * radius;
+    size_t found = 0;
+    auto visit = [&](const std::vector<Entry>& cell) {
+        for (const Entry& entry : cell) {
+            glm::vec3 delta = entry.position - center;
+            if (glm::dot(delta, delta) <= radiusSq) {
+                if (found < out.size()) {
+                    out[found] = entry.id;
+                }
+                ++found;
+            }
+        }
+    };
+
+    // A range wider than the occupied cell count is cheaper to scan directly
+    uint64_t rangeCells = static_cast<uint64_t>(x1 - x0 + 1) * static_cast<uint64_t>(z1 - z0 + 1);
+    if (rangeCells > cells.size()) {
+        for (const auto& [key, cell] : cells) {
+            visit(cell);
+        }
+        return found;
+    }
+
+    for (int32_t z = z0; z <= z1; ++z) {
+        for (int32_t x = x0; x <= x1; ++x) {
+            if (const std::vector<Entry>* cell = findCell(x, z)) {
+                visit(*cell);
+            }
+        }
+    }
+    return found;
+}
+
+size_t SpatialGrid::queryRect(const glm::vec2& min, const glm::vec2& max, std::span<uint64_t> out) const {
+    if (entryCount == 0 || min.x > max.x || min.y > max.y) {
+        return 0;
+    }
+
+    int32_t x0 = std::max(cellCoord(min.x), minCellX);
+    int32_t x1 = std::min(cellCoord(max.x), maxCellX);
+    int32_t z0 = std::max(cellCoord(min.y), minCellZ);
+    int32_t z1 = std::min(cellCoord(max.y), maxCellZ);
+    if (x0 > x1 || z0 > z1) {
+        return 0;
+    }
+
+    size_t found = 0;
+    auto visit = [&](const std::vector<Entry>& cell) {
+        for (const Entry& entry : cell) {
+            if (entry.position.x >= min.x && entry.position.x <= max.x &&
+                entry.position.z >= min.y && entry.position.z <= max.y) {
+                if (found < out.size()) {
+                    out[found] = entry.id;
+                }
+                ++found;
+            }
+        }
+    };
+
+    uint64_t rangeCells = static_cast<uint64_t>(x1 - x0 + 1) * static_cast<uint64_t>(z1 - z0 + 1);
+    if (rangeCells > cells.size()) {
+        for (const auto& [key, cell] : cells) {
+            visit(cell);
+        }
+        return found;
+    }
+
+    for (int32_t z = z0; z <= z1; ++z) {
+        for (int32_t x = x0; x <= x1; ++x) {
+            if (const std::vector<Entry>* cell = findCell(x, z)) {
+                visit(*cell);
+            }
+        }
+    }
+    return found;
+}
+
+uint64_t SpatialGrid::findNearest(const glm::vec3& position, float maxRadius) const {
+    if (entryCount == 0 || maxRadius < 0.0f) {
+        return 0;
+    }
+
+    uint64_t nearest = 0;
+    float nearestDistanceSq = maxRadius * maxRadius;
+    auto visit = [&](const std::vector<Entry>& cell) {
+        for (const Entry& entry : cell) {
+            glm::vec3 delta = entry.position - position;
+            float distanceSq = glm::dot(delta, delta);
+            if (distanceSq < nearestDistanceSq) {
+                nearestDistanceSq = distanceSq;
+                nearest = entry.id;
+            }
+        }
+    };
+
+    int32_t cx = cellCoord(position.x);
+    int32_t cz = cellCoord(position.z);
+
+    // Rings past the radius or the occupied area cannot hold a match
+    int64_t maxRing = static_cast<int64_t>(std::ceil(std::min(maxRadius * inverseCellSize, MAX_CELL_COORD)));
+    int64_t occupiedRing = std::max({static_cast<int64_t>(cx) - minCellX, static_cast<int64_t>(maxCellX) - cx,
+                                     static_cast<int64_t>(cz) - minCellZ, static_cast<int64_t>(maxCellZ) - cz});
+    maxRing = std::min(maxRing, occupiedRing);
+    if (maxRing < 0) {
+        return 0;
+    }
+
+    // A search area wider than the occupied cell count is cheaper to scan directly
+    uint64_t side = static_cast<uint64_t>(2 * maxRing + 1);
+    if (side * side > cells.size()) {
+        for (const auto& [key, cell] : cells) {
+            visit(cell);
+        }
+        return nearest;
+    }
+
+    for (int64_t ring = 0; ring <= maxRing; ++ring) {
+        for (int64_t dz = -ring; dz <= ring; ++dz) {
+            // Full rows on the top and bottom edge, two cells on the sides
+            int64_t step = (dz == -ring || dz == ring) ? 1 : std::max<int64_t>(2 * ring, 1);
+            for (int64_t dx = -ring; dx <= ring; dx += step) {
+                if (const std::vector<Entry>* cell = findCell(static_cast<int32_t>(cx + dx), static_cast<int32_t>(cz + dz))) {
+                    visit(*cell);
+                }
+            }
+        }
+
+        // Everything beyond this ring is at least ring cells away in XZ
+        float ringDistance = static_cast<float>(ring) * cellSize;
+        if (nearest != 0 && nearestDistanceSq <= ringDistance * ringDistance) {
+            break;
+        }
+    }
+    return nearest;
+}
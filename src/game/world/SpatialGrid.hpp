@@ -0,0 +1,102 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Uniform XZ hash grid of building positions
+ *
+ * Each building lives in the square cell containing its position; cells are
+ * hashed by coordinate so the world may be sparse and unbounded, and only
+ * occupied cells are kept (an emptied cell is erased). With the
+ * cell size matched to sector building spacing a cell holds about one
+ * building, and a query visits only the cells overlapping its shape (clamped
+ * to the occupied area) instead of every building.
+ *
+ * Queries write IDs into caller-provided spans and return the total number
+ * of matches, which may exceed the span size (the excess is not written).
+ */
+class SpatialGrid {
+public:
+    static constexpr float DEFAULT_CELL_SIZE = 50.0f;
+
+    explicit SpatialGrid(float initialCellSize = DEFAULT_CELL_SIZE);
+
+    /**
+     * @brief Change the cell size, re-bucketing every entry
+     * @param newCellSize Cell edge in meters (> 0)
+     */
+    void setCellSize(float newCellSize);
+    float getCellSize() const { return cellSize; }
+
+    /**
+     * @brief Add an entry
+     * @param id Entity ID
+     * @param position World position
+     */
+    void insert(uint64_t id, const glm::vec3& position);
+
+    /**
+     * @brief Remove an entry
+     * @param id Entity ID
+     * @param position Position it was inserted with
+     * @return False if not found
+     */
+    bool remove(uint64_t id, const glm::vec3& position);
+
+    /**
+     * @brief Remove every entry
+     */
+    void clear();
+
+    size_t size() const { return entryCount; }
+
+    /**
+     * @brief Entries within radius of center (3D distance)
+     * @param out Receives matching IDs, in no particular order
+     * @return Total number of matches
+     */
+    size_t queryRadius(const glm::vec3& center, float radius, std::span<uint64_t> out) const;
+
+    /**
+     * @brief Entries whose XZ position lies in [min, max] (x, z)
+     * @param out Receives matching IDs, in no particular order
+     * @return Total number of matches
+     */
+    size_t queryRect(const glm::vec2& min, const glm::vec2& max, std::span<uint64_t> out) const;
+
+    /**
+     * @brief Nearest entry within maxRadius (3D distance)
+     * @return Entity ID (0 if none)
+     *
+     * Searches rings of cells outward from the query cell and stops as soon
+     * as no unvisited ring can hold anything closer.
+     */
+    uint64_t findNearest(const glm::vec3& position, float maxRadius) const;
+
+private:
+    struct Entry {
+        glm::vec3 position;
+        uint64_t id;
+    };
+
+    int32_t cellCoord(float value) const;
+    static uint64_t cellKey(int32_t x, int32_t z) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z);
+    }
+    const std::vector<Entry>* findCell(int32_t x, int32_t z) const;
+
+    float cellSize;
+    float inverseCellSize;
+    std::unordered_map<uint64_t, std::vector<Entry>> cells;
+    size_t entryCount = 0;
+
+    // Occupied cell bounds (grow only; reset by clear()), used to clamp queries
+    int32_t minCellX = 0;
+    int32_t maxCellX = -1;
+    int32_t minCellZ = 0;
+    int32_t maxCellZ = -1;
+};
@@ -0,0 +1,540 @@
+#include "WorldSnapshot.hpp"
+#include "src/game/managers/WorldManager.hpp"
+#include "src/utils/Logger.hpp"
+#include "src/utils/MappedFile.hpp"
+#include <array>
+#include <chrono>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace worldsnapshot;
+
+namespace {
+
+constexpr size_t SECTION_COUNT = static_cast<size_t>(Section::Count);
+
+/**
+ * @brief Element size of every section in this build
+ */
+constexpr std::array<uint32_t, SECTION_COUNT> ELEMENT_SIZES = {
+    1,                              // Strings
+    sizeof(StringRef),              // Symbols
+    sizeof(SectorData),             // Sectors
+    sizeof(StringRef),              // SectorTickers
+    sizeof(SymbolId),               // Symbol
+    sizeof(glm::vec3),              // Position
+    sizeof(glm::vec3),              // BaseScale
+    sizeof(float),                  // CurrentPrice
+    sizeof(float),                  // PreviousPrice
+    sizeof(float),                  // PriceChangePercent
+    sizeof(float),                  // TickVolume
+    sizeof(uint64_t),               // LastUpdateTimestamp
+    sizeof(float),                  // CurrentHeight
+    sizeof(float),                  // TargetHeight
+    sizeof(ParticleEffectType),     // EffectType
+    sizeof(float),                  // EffectIntensity
+    sizeof(uint8_t),                // HasParticleEffect
+    sizeof(BuildingData),           // Records
+    sizeof(AnimationData),          // Animations
+};
+
+constexpr bool isBuildingColumn(Section section) {
+    return section >= Section::Symbol && section <= Section::Records;
+}
+
+uint64_t alignUp(uint64_t value) {
+    return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Word-wise checksum (four independent lanes, so it runs near memory speed)
+ * @param size Multiple of 8
+ */
+uint64_t checksum(const std::byte* data, size_t size) {
+    constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+    uint64_t lanes[4] = {PRIME1, PRIME2, 0, ~PRIME1};
+
+    size_t words = size / sizeof(uint64_t);
+    for (size_t w = 0; w < words; ++w) {
+        uint64_t word;
+        std::memcpy(&word, data + w * sizeof(uint64_t), sizeof(word));
+        uint64_t& lane = lanes[w & 3];
+        lane += word * PRIME2;
+        lane = ((lane << 31) | (lane >> 33)) * PRIME1;
+    }
+
+    uint64_t hash = size;
+    for (uint64_t lane : lanes) {
+        hash = (hash ^ lane) * PRIME1;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+/**
+ * @brief Deduplicating string blob for the Strings section
+ */
+class StringBlob {
+public:
+    StringRef add(std::string_view text) {
+        auto [it, inserted] = refs.try_emplace(text, StringRef{static_cast<uint32_t>(blob.size()),
+                                                               static_cast<uint32_t>(text.size())});
+        if (inserted) {
+            blob.append(text);
+        }
+        return it->second;
+    }
+
+    const std::string& data() const { return blob; }
+
+private:
+    std::string blob;
+    std::unordered_map<std::string_view, StringRef> refs;  // Views into callers' strings (alive during save)
+};
+
+/**
+ * @brief Source of one section while saving
+ */
+struct PendingSection {
+    const void* data = nullptr;
+    uint64_t count = 0;
+};
+
+uint64_t nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+}
+
+/**
+ * @brief Validated, mapped snapshot
+ */
+class Reader {
+public:
+    bool open(const std::string& path) {
+        if (!file.openRead(path)) {
+            return false;
+        }
+        if (file.size() < sizeof(FileHeader)) {
+            LOG_ERROR("WorldSnapshot") << path << " is too small to be a world snapshot";
+            return false;
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (header.magic != MAGIC || header.version != VERSION || header.headerBytes != sizeof(FileHeader)
+            || header.fileBytes != file.size() || header.fileBytes % sizeof(uint64_t) != 0
+            || header.sectionCount != SECTION_COUNT
+            || sizeof(FileHeader) + SECTION_COUNT * sizeof(SectionEntry) > header.fileBytes) {
+            LOG_ERROR("WorldSnapshot") << path << " is not a compatible world snapshot";
+            return false;
+        }
+        if (checksum(file.data() + sizeof(FileHeader), file.size() - sizeof(FileHeader)) != header.checksum) {
+            LOG_ERROR("WorldSnapshot") << path << " is corrupt (checksum mismatch)";
+            return false;
+        }
+
+        std::array<bool, SECTION_COUNT> seen{};
+        for (size_t s = 0; s < SECTION_COUNT; ++s) {
+            SectionEntry entry;
+            std::memcpy(&entry, file.data() + sizeof(FileHeader) + s * sizeof(SectionEntry), sizeof(entry));
+            if (entry.id >= SECTION_COUNT || seen[entry.id] || entry.elementSize != ELEMENT_SIZES[entry.id]
+                || entry.offset % SECTION_ALIGNMENT != 0 || entry.offset > header.fileBytes
+                || entry.count > (header.fileBytes - entry.offset) / entry.elementSize
+                || entry.count != expectedCount(static_cast<Section>(entry.id), entry.count)) {
+                LOG_ERROR("WorldSnapshot") << path << " has an invalid or incompatible section " << entry.id;
+                return false;
+            }
+            seen[entry.id] = true;
+            sections[entry.id] = entry;
+        }
+        return true;
+    }
+
+    template<typename T>
+    std::span<const T> view(Section section) const {
+        const SectionEntry& entry = sections[static_cast<size_t>(section)];
+        return std::span<const T>(reinterpret_cast<const T*>(file.data() + entry.offset), entry.count);
+    }
+
+    const FileHeader& getHeader() const { return header; }
+
+private:
+    uint64_t expectedCount(Section section, uint64_t count) const {
+        if (isBuildingColumn(section)) {
+            return header.buildingCount;
+        }
+        switch (section) {
+            case Section::Symbols:    return header.symbolCount;
+            case Section::Sectors:    return header.sectorCount;
+            case Section::Animations: return header.animationCount;
+            default:                  return count;
+        }
+    }
+
+    MappedFile file;
+    FileHeader header{};
+    std::array<SectionEntry, SECTION_COUNT> sections{};
+};
+
+bool validRef(StringRef ref, size_t blobSize) {
+    return ref.offset <= blobSize && ref.length <= blobSize - ref.offset;
+}
+
+/**
+ * @brief Check every cross-reference, so a loaded snapshot never indexes out of range
+ */
+bool validateReferences(const Reader& reader) {
+    const size_t blobSize = reader.view<char>(Section::Strings).size();
+    const uint32_t symbolCount = reader.getHeader().symbolCount;
+    const uint32_t buildingCount = reader.getHeader().buildingCount;
+    const size_t tickerCount = reader.view<StringRef>(Section::SectorTickers).size();
+
+    // Distinct names, so distinct snapshot SymbolIds stay distinct once re-interned
+    std::span<const char> blob = reader.view<char>(Section::Strings);
+    std::span<const StringRef> symbolNames = reader.view<StringRef>(Section::Symbols);
+    std::unordered_set<std::string_view> names;
+    names.reserve(symbolNames.size());
+    for (StringRef ref : symbolNames) {
+        if (!validRef(ref, blobSize) || !names.emplace(blob.data() + ref.offset, ref.length).second) return false;
+    }
+    for (StringRef ref : reader.view<StringRef>(Section::SectorTickers)) {
+        if (!validRef(ref, blobSize)) return false;
+    }
+    for (const SectorData& sector : reader.view<SectorData>(Section::Sectors)) {
+        if (!validRef(sector.id, blobSize) || !validRef(sector.displayName, blobSize)
+            || sector.firstTicker > tickerCount || sector.tickerCount > tickerCount - sector.firstTicker) {
+            return false;
+        }
+    }
+    for (const BuildingData& record : reader.view<BuildingData>(Section::Records)) {
+        if (!validRef(record.companyName, blobSize) || !validRef(record.sectorId, blobSize)) return false;
+    }
+    // Each symbol names at most one building (the store's symbol map is one-to-one)
+    std::vector<uint8_t> symbolUsed(symbolCount, 0);
+    for (SymbolId symbol : reader.view<SymbolId>(Section::Symbol)) {
+        if (symbol >= symbolCount || symbolUsed[symbol]) return false;
+        symbolUsed[symbol] = 1;
+    }
+    for (ParticleEffectType effect : reader.view<ParticleEffectType>(Section::EffectType)) {
+        if (static_cast<uint32_t>(effect) > static_cast<uint32_t>(ParticleEffectType::Sparkle)) return false;
+    }
+    for (const AnimationData& animation : reader.view<AnimationData>(Section::Animations)) {
+        if (animation.owner >= buildingCount || animation.curve >= static_cast<uint32_t>(EasingCurve::Count)
+            || !(animation.duration > 0.0f)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+namespace worldsnapshot {
+
+/**
+ * @brief A world's state copied out for writing (owns everything it refers to)
+ */
+struct Capture {
+    struct Record {
+        std::string companyName;
+        std::string sectorId;
+        glm::vec4 rotation;
+        float marketCap;
+        float volume24h;
+    };
+
+    size_t symbolCount = 0;                 // Names are read from the SymbolTable (append-only)
+    std::vector<Sector> sectors;
+    BuildingColumns columns;
+    std::vector<Record> records;
+    std::vector<AnimationData> animations;
+};
+
+namespace {
+
+/**
+ * @brief Copy what a snapshot stores (on the thread that owns the world)
+ *
+ * Assigns into data's existing containers, so a reused capture costs
+ * copies only, not allocations.
+ * @return False while the world is scrubbing the timeline
+ */
+bool capture(const WorldManager& world, const std::string& path, Capture& data) {
+    if (world.isScrubbing()) {
+        // The columns hold a reconstructed past, not the world
+        LOG_WARN("WorldSnapshot") << "Not saving " << path << " while scrubbing the timeline";
+        return false;
+    }
+
+    const BuildingManager& buildings = *world.getBuildingManager();
+    const BuildingStore& store = buildings.getStore();
+
+    data.symbolCount = SymbolTable::global().size();
+    data.sectors = world.getAllSectors();
+    data.columns = store.columns();
+    data.records.resize(store.size());
+    for (uint32_t i = 0; i < store.size(); ++i) {
+        const BuildingRecord& record = store.record(i);
+        Capture::Record& copy = data.records[i];
+        copy.companyName = record.companyName;
+        copy.sectorId = record.sectorId;
+        copy.rotation = record.rotation;
+        copy.marketCap = record.marketCap;
+        copy.volume24h = record.volume24h;
+    }
+    data.animations.clear();
+    buildings.getAnimations().forEach([&data](uint32_t owner, const AnimationPool::State& state) {
+        data.animations.push_back(AnimationData{owner, state.start, state.target, state.progress,
+                                                state.duration, static_cast<uint32_t>(state.curve)});
+    });
+    return true;
+}
+
+/**
+ * @brief Encode a capture and write it to path (any thread)
+ */
+bool write(const Capture& data, const std::string& path) {
+    auto start = std::chrono::steady_clock::now();
+    const BuildingColumns& c = data.columns;
+    const uint32_t buildingCount = static_cast<uint32_t>(data.records.size());
+
+    // Cold data and strings
+    StringBlob strings;
+    const SymbolTable& symbolTable = SymbolTable::global();
+    std::vector<StringRef> symbolNames(data.symbolCount);
+    for (SymbolId id = 0; id < symbolNames.size(); ++id) {
+        symbolNames[id] = strings.add(symbolTable.name(id));
+    }
+
+    std::vector<SectorData> sectors;
+    std::vector<StringRef> sectorTickers;
+    sectors.reserve(data.sectors.size());
+    for (const Sector& sector : data.sectors) {
+        SectorData& entry = sectors.emplace_back();
+        entry.id = strings.add(sector.id);
+        entry.displayName = strings.add(sector.displayName);
+        entry.centerPosition = sector.centerPosition;
+        entry.width = sector.width;
+        entry.depth = sector.depth;
+        entry.layoutType = static_cast<uint32_t>(sector.layoutType);
+        entry.buildingSpacing = sector.buildingSpacing;
+        entry.gridRows = sector.gridRows;
+        entry.gridColumns = sector.gridColumns;
+        entry.borderColor = sector.borderColor;
+        entry.groundColor = sector.groundColor;
+        entry.maxBuildings = sector.maxBuildings;
+        entry.currentBuildingCount = sector.currentBuildingCount;
+        entry.firstTicker = static_cast<uint32_t>(sectorTickers.size());
+        entry.tickerCount = static_cast<uint32_t>(sector.tickers.size());
+        entry.showBorder = sector.showBorder ? 1 : 0;
+        entry.showGrid = sector.showGrid ? 1 : 0;
+        for (const std::string& ticker : sector.tickers) {
+            sectorTickers.push_back(strings.add(ticker));
+        }
+    }
+
+    std::vector<BuildingData> records(buildingCount);
+    for (uint32_t i = 0; i < buildingCount; ++i) {
+        const Capture::Record& record = data.records[i];
+        records[i] = BuildingData{strings.add(record.companyName), strings.add(record.sectorId),
+                                  record.rotation, record.marketCap, record.volume24h};
+    }
+    const std::vector<AnimationData>& animations = data.animations;
+
+    // Section sources, in Section order
+    std::array<PendingSection, SECTION_COUNT> pending = {{
+        {strings.data().data(), strings.data().size()},
+        {symbolNames.data(), symbolNames.size()},
+        {sectors.data(), sectors.size()},
+        {sectorTickers.data(), sectorTickers.size()},
+        {c.symbol.data(), buildingCount},
+        {c.position.data(), buildingCount},
+        {c.baseScale.data(), buildingCount},
+        {c.currentPrice.data(), buildingCount},
+        {c.previousPrice.data(), buildingCount},
+        {c.priceChangePercent.data(), buildingCount},
+        {c.tickVolume.data(), buildingCount},
+        {c.lastUpdateTimestamp.data(), buildingCount},
+        {c.currentHeight.data(), buildingCount},
+        {c.targetHeight.data(), buildingCount},
+        {c.effectType.data(), buildingCount},
+        {c.effectIntensity.data(), buildingCount},
+        {c.hasParticleEffect.data(), buildingCount},
+        {records.data(), records.size()},
+        {animations.data(), animations.size()},
+    }};
+
+    // Lay out sections after the header and section table
+    std::array<SectionEntry, SECTION_COUNT> entries;
+    uint64_t fileBytes = alignUp(sizeof(FileHeader) + sizeof(entries));
+    for (size_t s = 0; s < SECTION_COUNT; ++s) {
+        entries[s] = SectionEntry{static_cast<uint32_t>(s), ELEMENT_SIZES[s], fileBytes, pending[s].count};
+        fileBytes = alignUp(fileBytes + pending[s].count * ELEMENT_SIZES[s]);
+    }
+
+    // Write a temporary file and rename it over the snapshot once it is on disk
+    const std::string tempPath = path + ".tmp";
+    MappedFile file;
+    if (!file.create(tempPath, fileBytes)) {
+        return false;
+    }
+
+    std::byte* base = file.data();
+    std::memset(base, 0, fileBytes);
+    std::memcpy(base + sizeof(FileHeader), entries.data(), sizeof(entries));
+    for (size_t s = 0; s < SECTION_COUNT; ++s) {
+        if (pending[s].count > 0) {
+            std::memcpy(base + entries[s].offset, pending[s].data, pending[s].count * ELEMENT_SIZES[s]);
+        }
+    }
+
+    FileHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.headerBytes = sizeof(FileHeader);
+    header.fileBytes = fileBytes;
+    header.createdTimestamp = nowMs();
+    header.checksum = checksum(base + sizeof(FileHeader), fileBytes - sizeof(FileHeader));
+    header.sectionCount = static_cast<uint32_t>(SECTION_COUNT);
+    header.buildingCount = buildingCount;
+    header.sectorCount = static_cast<uint32_t>(sectors.size());
+    header.symbolCount = static_cast<uint32_t>(symbolNames.size());
+    header.animationCount = static_cast<uint32_t>(animations.size());
+    std::memcpy(base, &header, sizeof(header));
+
+    bool synced = file.sync();
+    file.close();
+    if (!synced || std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        LOG_ERROR("WorldSnapshot") << "Failed to write " << path << ": " << std::strerror(errno);
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // The rename itself lives in the directory: sync it, or a crash may undo the save
+    if (!MappedFile::syncParentDirectory(path)) {
+        LOG_WARN("WorldSnapshot") << "Saved " << path << " but could not make the rename durable";
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG_INFO("WorldSnapshot") << "Saved " << buildingCount << " buildings, " << sectors.size() << " sectors to "
+                              << path << " (" << (fileBytes >> 10) << " KB, " << seconds * 1000.0 << " ms)";
+    return true;
+}
+
+} // anonymous namespace
+
+bool save(const WorldManager& world, const std::string& path) {
+    Capture data;
+    return capture(world, path, data) && write(data, path);
+}
+
+AsyncSaver::AsyncSaver() : data(std::make_unique<Capture>()) {
+}
+
+AsyncSaver::~AsyncSaver() {
+    wait();
+}
+
+bool AsyncSaver::request(const WorldManager& world, const std::string& path) {
+    if (busy.load(std::memory_order_acquire)) {
+        return false;
+    }
+    wait();  // Joins the finished previous save, which released data
+
+    if (!capture(world, path, *data)) {
+        return false;
+    }
+    busy.store(true, std::memory_order_release);
+    thread = std::thread([this, path]() {
+        write(*data, path);
+        busy.store(false, std::memory_order_release);
+    });
+    return true;
+}
+
+void AsyncSaver::wait() {
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+bool load(WorldManager& world, const std::string& path) {
+    auto start = std::chrono::steady_clock::now();
+    Reader reader;
+    if (!reader.open(path)) {
+        return false;
+    }
+    if (!validateReferences(reader)) {
+        LOG_ERROR("WorldSnapshot") << path << " has out-of-range or duplicate references";
+        return false;
+    }
+
+    BuildingView view;
+    view.count = reader.getHeader().buildingCount;
+    view.symbol = reader.view<SymbolId>(Section::Symbol);
+    view.position = reader.view<glm::vec3>(Section::Position);
+    view.baseScale = reader.view<glm::vec3>(Section::BaseScale);
+    view.currentPrice = reader.view<float>(Section::CurrentPrice);
+    view.previousPrice = reader.view<float>(Section::PreviousPrice);
+    view.priceChangePercent = reader.view<float>(Section::PriceChangePercent);
+    view.tickVolume = reader.view<float>(Section::TickVolume);
+    view.lastUpdateTimestamp = reader.view<uint64_t>(Section::LastUpdateTimestamp);
+    view.currentHeight = reader.view<float>(Section::CurrentHeight);
+    view.targetHeight = reader.view<float>(Section::TargetHeight);
+    view.effectType = reader.view<ParticleEffectType>(Section::EffectType);
+    view.effectIntensity = reader.view<float>(Section::EffectIntensity);
+    view.hasParticleEffect = reader.view<uint8_t>(Section::HasParticleEffect);
+    view.records = reader.view<BuildingData>(Section::Records);
+    view.animations = reader.view<AnimationData>(Section::Animations);
+    view.symbolNames = reader.view<StringRef>(Section::Symbols);
+    std::span<const char> blob = reader.view<char>(Section::Strings);
+    view.strings = std::string_view(blob.data(), blob.size());
+
+    // Snapshot SymbolIds -> this process's (identity in a fresh process)
+    std::vector<SymbolId> symbolRemap(view.symbolNames.size());
+    for (size_t s = 0; s < symbolRemap.size(); ++s) {
+        symbolRemap[s] = SymbolTable::global().intern(view.string(view.symbolNames[s]));
+    }
+    view.symbolRemap = symbolRemap;
+
+    std::vector<Sector> sectors;
+    std::span<const StringRef> sectorTickers = reader.view<StringRef>(Section::SectorTickers);
+    for (const SectorData& data : reader.view<SectorData>(Section::Sectors)) {
+        Sector& sector = sectors.emplace_back();
+        sector.id = view.string(data.id);
+        sector.displayName = view.string(data.displayName);
+        sector.centerPosition = data.centerPosition;
+        sector.width = data.width;
+        sector.depth = data.depth;
+        sector.layoutType = static_cast<GridLayoutType>(data.layoutType);
+        sector.buildingSpacing = data.buildingSpacing;
+        sector.gridRows = data.gridRows;
+        sector.gridColumns = data.gridColumns;
+        sector.borderColor = data.borderColor;
+        sector.groundColor = data.groundColor;
+        sector.showBorder = data.showBorder != 0;
+        sector.showGrid = data.showGrid != 0;
+        sector.maxBuildings = data.maxBuildings;
+        sector.currentBuildingCount = data.currentBuildingCount;
+        sector.tickers.reserve(data.tickerCount);
+        for (StringRef ticker : sectorTickers.subspan(data.firstTicker, data.tickerCount)) {
+            sector.tickers.emplace_back(view.string(ticker));
+        }
+    }
+
+    world.replaceSectors(std::move(sectors));
+    world.getBuildingManager()->restoreBuildings(view);
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG_INFO("WorldSnapshot") << "Loaded " << view.count << " buildings, " << world.getSectorCount()
+                              << " sectors, " << view.animations.size() << " animations from " << path
+                              << " in " << seconds * 1000.0 << " ms";
+    return true;
+}
+
+} // namespace worldsnapshot
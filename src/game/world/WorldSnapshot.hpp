@@ -0,0 +1,228 @@
+#pragma once
+
+#include "src/game/entities/BuildingEntity.hpp"
+#include "src/game/sync/SymbolTable.hpp"
+#include <glm/glm.hpp>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+
+class WorldManager;
+
+/**
+ * @brief World snapshot layout (sectors, buildings, symbols, prices, animations)
+ *
+ *   FileHeader (64 bytes)
+ *   SectionEntry[sectionCount]
+ *   sections, each 16-byte aligned
+ *
+ * Sections are plain arrays addressed by file offset, so a mapped snapshot
+ * is read in place with no pointer fix-ups: building columns are copied
+ * into the store wholesale, strings are StringRefs into one blob. Each
+ * section records its element size, and a snapshot whose sizes differ from
+ * this build's is rejected rather than misread. The checksum covers
+ * everything after the header.
+ *
+ * Snapshots are written to "<path>.tmp", synced and renamed over path, so a
+ * crash mid-save leaves the previous snapshot intact.
+ */
+namespace worldsnapshot {
+
+inline constexpr uint32_t MAGIC = 0x5357444Du;      // "MDWS"
+inline constexpr uint16_t VERSION = 1;
+inline constexpr uint64_t SECTION_ALIGNMENT = 16;
+
+/**
+ * @brief Sections of a snapshot (a file holds each exactly once)
+ */
+enum class Section : uint32_t {
+    Strings,                // char blob
+    Symbols,                // StringRef per SymbolId at save time
+    Sectors,                // SectorData
+    SectorTickers,          // StringRef, ranges referenced by SectorData
+    Symbol,                 // Building columns, one element per building...
+    Position,
+    BaseScale,
+    CurrentPrice,
+    PreviousPrice,
+    PriceChangePercent,
+    TickVolume,
+    LastUpdateTimestamp,
+    CurrentHeight,
+    TargetHeight,
+    EffectType,
+    EffectIntensity,
+    HasParticleEffect,
+    Records,                // ...BuildingData (cold fields)
+    Animations,             // AnimationData per running animation
+    Count
+};
+
+#pragma pack(push, 1)
+struct FileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerBytes;
+    uint64_t fileBytes;
+    uint64_t createdTimestamp;  // Milliseconds since epoch
+    uint64_t checksum;          // Of bytes [headerBytes, fileBytes)
+    uint32_t sectionCount;
+    uint32_t buildingCount;
+    uint32_t sectorCount;
+    uint32_t symbolCount;
+    uint32_t animationCount;
+    uint8_t reserved[12];
+};
+#pragma pack(pop)
+
+struct SectionEntry {
+    uint32_t id;                // Section
+    uint32_t elementSize;       // Bytes per element in this build
+    uint64_t offset;            // File offset (SECTION_ALIGNMENT aligned)
+    uint64_t count;             // Elements
+};
+
+struct StringRef {
+    uint32_t offset;            // Into the Strings section
+    uint32_t length;
+};
+
+struct SectorData {
+    StringRef id;
+    StringRef displayName;
+    glm::vec3 centerPosition;
+    float width;
+    float depth;
+    uint32_t layoutType;
+    float buildingSpacing;
+    uint32_t gridRows;
+    uint32_t gridColumns;
+    glm::vec4 borderColor;
+    glm::vec4 groundColor;
+    uint32_t maxBuildings;
+    uint32_t currentBuildingCount;
+    uint32_t firstTicker;       // Range in SectorTickers
+    uint32_t tickerCount;
+    uint8_t showBorder;
+    uint8_t showGrid;
+    uint8_t pad[2];
+};
+
+struct BuildingData {
+    StringRef companyName;
+    StringRef sectorId;
+    glm::vec4 rotation;
+    float marketCap;
+    float volume24h;
+};
+
+struct AnimationData {
+    uint32_t owner;             // Building index
+    float start;
+    float target;
+    float progress;
+    float duration;
+    uint32_t curve;             // EasingCurve
+};
+
+static_assert(sizeof(FileHeader) == 64);
+static_assert(sizeof(SectionEntry) == 24);
+static_assert(sizeof(SectorData) == 104);
+static_assert(std::endian::native == std::endian::little,
+              "Snapshots are read in place and assume a little-endian host");
+
+/**
+ * @brief A mapped snapshot's buildings, as BuildingManager::restoreBuildings() consumes them
+ *
+ * Spans point into the mapping; ticker names come from symbolNames via the
+ * snapshot SymbolIds in symbol, and symbolRemap translates those IDs to
+ * this process's SymbolTable.
+ */
+struct BuildingView {
+    uint32_t count = 0;
+    std::span<const SymbolId> symbol;
+    std::span<const glm::vec3> position;
+    std::span<const glm::vec3> baseScale;
+    std::span<const float> currentPrice;
+    std::span<const float> previousPrice;
+    std::span<const float> priceChangePercent;
+    std::span<const float> tickVolume;
+    std::span<const uint64_t> lastUpdateTimestamp;
+    std::span<const float> currentHeight;
+    std::span<const float> targetHeight;
+    std::span<const ParticleEffectType> effectType;
+    std::span<const float> effectIntensity;
+    std::span<const uint8_t> hasParticleEffect;
+    std::span<const BuildingData> records;
+    std::span<const AnimationData> animations;
+    std::span<const StringRef> symbolNames;
+    std::span<const SymbolId> symbolRemap;
+    std::string_view strings;
+
+    std::string_view string(StringRef ref) const {
+        return strings.substr(ref.offset, ref.length);
+    }
+};
+
+/**
+ * @brief Write the world to a snapshot (atomically replaces path)
+ * @return False (and logs) on I/O failure or while the world is scrubbing
+ *         the timeline (call WorldManager::resumeLive() first); the
+ *         previous file is kept
+ */
+bool save(const WorldManager& world, const std::string& path);
+
+struct Capture;
+
+/**
+ * @brief Writes snapshots on a background thread, one at a time
+ *
+ * request() only copies the world on the calling thread (columns, records,
+ * sectors and animations: about 4 ms at 100K buildings once the copy's
+ * buffers are warm, as they are kept between saves); encoding, writing,
+ * both fsyncs and the rename happen on a writer thread, so a periodic save
+ * does not stall the frame. A request while the previous save is still
+ * being written is refused rather than queued. Synchronous save()s to the
+ * same path must wait() first: both write "<path>.tmp".
+ */
+class AsyncSaver {
+public:
+    AsyncSaver();
+    ~AsyncSaver();  // Waits for the save in flight
+
+    AsyncSaver(const AsyncSaver&) = delete;
+    AsyncSaver& operator=(const AsyncSaver&) = delete;
+
+    /**
+     * @brief Copy the world and start writing it to path
+     * @return False if a save is in flight or the world is scrubbing; failures
+     *         of the write itself are only logged
+     */
+    bool request(const WorldManager& world, const std::string& path);
+
+    /**
+     * @brief Block until the save in flight (if any) is on disk
+     */
+    void wait();
+
+    bool isBusy() const { return busy.load(std::memory_order_acquire); }
+
+private:
+    std::unique_ptr<Capture> data;  // Owned by the writer thread while busy
+    std::thread thread;
+    std::atomic<bool> busy{false};
+};
+
+/**
+ * @brief Replace the world's sectors and buildings with a snapshot's
+ * @return False (and logs) if the file is missing, corrupt or from an
+ *         incompatible build; the world is then left unchanged
+ */
+bool load(WorldManager& world, const std::string& path);
+
+} // namespace worldsnapshot
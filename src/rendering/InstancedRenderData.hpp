@@ -3,6 +3,7 @@
 #include <rhi/RHI.hpp>
 #include <glm/glm.hpp>
 #include <cstdint>
+#include <span>
 
 namespace rendering {
 
@@ -21,6 +22,25 @@ struct alignas(16) ObjectData {
     // Total: 128 bytes
 };
 
+/**
+ * @brief Per-sector data for sector-level effects (ground tint, labels, glow)
+ */
+struct SectorRenderData {
+    glm::vec4 bounds;           // XZ extent: (minX, minZ, maxX, maxZ)
+    glm::vec4 stats;            // x=volume-weighted change %, y=breadth (advancers - decliners) / count,
+                                // z=building count, w=unused
+};
+
+/**
+ * @brief GPU-compatible price candle for instanced chart rendering (std430 layout)
+ */
+struct alignas(16) CandleData {
+    glm::vec4 ohlc;             // 16 bytes — open, high, low, close
+    glm::vec4 timeVolume;       // 16 bytes — x=bucket start in seconds relative to the packing time,
+                                //            y=volume, z=1 if the candle exists, w=pad
+    // Total: 32 bytes
+};
+
 /**
  * @brief Pure rendering data for GPU instanced objects
  *
@@ -36,6 +56,9 @@ struct InstancedRenderData {
 
     // Number of instances to render
     uint32_t instanceCount = 0;
+
+    // Sector aggregates (owned by game logic, valid for the submitted frame)
+    std::span<const SectorRenderData> sectors;
 };
 
 } // namespace rendering
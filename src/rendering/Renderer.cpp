@@ -5,6 +5,7 @@
 #endif
 #include "InstancedRenderData.hpp"
 #include "src/utils/Logger.hpp"
+#include "src/utils/LatencyTracer.hpp"
 #include "src/utils/FileUtils.hpp"
 
 // Phase 9: Vulkan-specific includes for platform-specific functionality
@@ -1489,6 +1490,7 @@ void Renderer::drawFrame() {
     // Complete RHI rendering path using RHI abstractions
     // Phase 7: Replaces legacy Vulkan rendering (now drawFrameLegacy)
 
+    lastSubmitTime = 0;
     if (!rhiBridge || !rhiBridge->isReady()) {
         return;
     }
@@ -1949,8 +1951,51 @@ void Renderer::drawFrame() {
                 rhiBridge->getInFlightFence()
             );
         }
+        lastSubmitTime = latency::now();
     }
 
     // Step 5: Present frame
     rhiBridge->endFrame();
+
+    if (lastSubmitTime == 0) {
+        return;
+    }
+    auto* presentedSwapchain = rhiBridge->getSwapchain();
+    if (presentWaitEnabled && presentedSwapchain && presentedSwapchain->supportsPresentWait()) {
+        // Display time is taken by waitForPresentedFrame() at the start of the next frame
+        pendingPresentId = presentedSwapchain->getLastPresentId();
+        pendingSubmitTime = lastSubmitTime;
+    } else {
+        completedPresent = PresentTiming{lastSubmitTime, latency::now(), false};
+        hasCompletedPresent = true;
+    }
+}
+
+bool Renderer::takePresentTiming(PresentTiming& out) {
+    if (!hasCompletedPresent) {
+        return false;
+    }
+    out = completedPresent;
+    hasCompletedPresent = false;
+    return true;
+}
+
+bool Renderer::isPresentWaitSupported() {
+    auto* swapchain = getRHISwapchain();
+    return swapchain && swapchain->supportsPresentWait();
+}
+
+void Renderer::waitForPresentedFrame() {
+    if (pendingPresentId == 0) {
+        return;
+    }
+
+    // Bounded so a hidden or occluded window cannot stall the loop
+    constexpr uint64_t PRESENT_WAIT_TIMEOUT_NS = 100'000'000;
+    auto* swapchain = getRHISwapchain();
+    if (swapchain && swapchain->waitForPresent(pendingPresentId, PRESENT_WAIT_TIMEOUT_NS)) {
+        completedPresent = PresentTiming{pendingSubmitTime, latency::now(), true};
+        hasCompletedPresent = true;
+    }
+    pendingPresentId = 0;
 }
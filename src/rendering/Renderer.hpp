@@ -117,6 +117,50 @@ public:
      */
     rhi::RHIQueue* getGraphicsQueue() { return rhiBridge ? rhiBridge->getGraphicsQueue() : nullptr; }
 
+    // ========== Frame timing (latency tracing) ==========
+
+    /**
+     * @brief CPU timestamps of one presented frame (latency::now() nanoseconds)
+     */
+    struct PresentTiming {
+        uint64_t submitTime = 0;    // Graphics submit returned
+        uint64_t presentTime = 0;   // Displayed (present wait) or present call returned
+        bool displayed = false;     // presentTime comes from a present wait
+    };
+
+    /**
+     * @brief Submit time of the last drawFrame() (0 if that frame was skipped)
+     */
+    uint64_t getLastSubmitTime() const { return lastSubmitTime; }
+
+    /**
+     * @brief Take the timing of the most recently completed present
+     * @return False if no present completed since the last call
+     */
+    bool takePresentTiming(PresentTiming& out);
+
+    /**
+     * @brief Whether the swapchain can report when a frame reaches the display
+     */
+    bool isPresentWaitSupported();
+
+    /**
+     * @brief Track presents with present IDs and waitForPresentedFrame()
+     *
+     * Without present wait, presentTime is when the present call returned.
+     */
+    void setPresentWait(bool enabled) { presentWaitEnabled = enabled; }
+    bool isPresentWaitEnabled() const { return presentWaitEnabled; }
+
+    /**
+     * @brief Block until the last presented frame is on screen (present wait only)
+     *
+     * Call at the start of a frame: besides timestamping the present, it
+     * paces the loop to the display so market data is sampled right after
+     * the previous frame became visible instead of queueing frames ahead.
+     */
+    void waitForPresentedFrame();
+
 #ifndef __EMSCRIPTEN__
     /**
      * @brief Get ImGui manager (for external UI updates)
@@ -237,6 +281,14 @@ private:
     std::unique_ptr<class GpuProfiler> gpuProfiler;
 #endif
 
+    // Frame timing (latency tracing)
+    uint64_t lastSubmitTime = 0;
+    bool presentWaitEnabled = false;
+    uint64_t pendingPresentId = 0;          // Present awaiting waitForPresentedFrame()
+    uint64_t pendingSubmitTime = 0;
+    PresentTiming completedPresent;
+    bool hasCompletedPresent = false;
+
     // Phase 3.2: Async compute
     std::unique_ptr<rhi::RHITimelineSemaphore> computeTimelineSemaphore;
     uint64_t computeTimelineValue = 0;
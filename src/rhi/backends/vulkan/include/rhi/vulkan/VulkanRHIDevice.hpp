@@ -101,6 +101,7 @@ public:
     vk::CommandPool getComputeCommandPool() { return m_hasDedicatedComputeQueue ? *m_computeCommandPool : *m_commandPool; }
     bool hasDedicatedComputeQueue() const { return m_hasDedicatedComputeQueue; }
     bool hasTimelineSemaphoreSupport() const { return m_hasTimelineSemaphores; }
+    bool hasPresentWaitSupport() const { return m_hasPresentWait; }
 
 private:
     // Initialization methods
@@ -135,6 +136,7 @@ private:
     uint32_t m_computeQueueFamily = ~0u;
     bool m_hasDedicatedComputeQueue = false;
     bool m_hasTimelineSemaphores = false;
+    bool m_hasPresentWait = false;      // VK_KHR_present_id + VK_KHR_present_wait enabled
 
     // VMA
     VmaAllocator m_vmaAllocator = VK_NULL_HANDLE;
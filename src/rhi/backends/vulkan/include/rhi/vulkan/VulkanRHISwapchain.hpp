@@ -50,6 +50,9 @@ public:
     }
 
     void ensureRenderResourcesReady(rhi::RHITextureView* depthView = nullptr) override;
+    bool supportsPresentWait() const override;
+    uint64_t getLastPresentId() const override { return m_lastPresentId; }
+    bool waitForPresent(uint64_t presentId, uint64_t timeoutNs) override;
 
     // Vulkan-specific accessors
     vk::SwapchainKHR getVkSwapchain() const { return *m_swapchain; }
@@ -82,6 +85,7 @@ private:
     TextureFormat m_format;
 
     uint32_t m_currentImageIndex = 0;
+    uint64_t m_lastPresentId = 0;   // Tagged on each present when present wait is enabled
     uint32_t m_bufferCount;
 
     // Linux compatibility: Render pass for ImGui (Vulkan 1.1)
@@ -12,6 +12,7 @@
 #include <rhi/vulkan/VulkanRHISwapchain.hpp>
 #include <iostream>
 #include <set>
+#include <string_view>
 
 namespace RHI {
 namespace Vulkan {
@@ -229,6 +230,36 @@ void VulkanRHIDevice::createLogicalDevice() {
         ? static_cast<void*>(&timelineSemaphoreFeatures)
         : static_cast<void*>(&sync2Features);
 
+    // Optional present timing: present IDs plus waiting for them to reach the display
+    bool hasPresentIdExtension = false;
+    bool hasPresentWaitExtension = false;
+    for (const auto& extension : m_physicalDevice.enumerateDeviceExtensionProperties()) {
+        std::string_view name(extension.extensionName.data());
+        hasPresentIdExtension |= name == VK_KHR_PRESENT_ID_EXTENSION_NAME;
+        hasPresentWaitExtension |= name == VK_KHR_PRESENT_WAIT_EXTENSION_NAME;
+    }
+    if (hasPresentIdExtension && hasPresentWaitExtension) {
+        auto presentChain = m_physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2,
+            vk::PhysicalDevicePresentIdFeaturesKHR, vk::PhysicalDevicePresentWaitFeaturesKHR>();
+        m_hasPresentWait = presentChain.get<vk::PhysicalDevicePresentIdFeaturesKHR>().presentId
+            && presentChain.get<vk::PhysicalDevicePresentWaitFeaturesKHR>().presentWait;
+    }
+    std::cout << "Present wait: " << (m_hasPresentWait ? "supported" : "not supported") << std::endl;
+
+    vk::PhysicalDevicePresentIdFeaturesKHR presentIdFeatures{
+        .pNext = featureChainHead,
+        .presentId = VK_TRUE
+    };
+    vk::PhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures{
+        .pNext = &presentIdFeatures,
+        .presentWait = VK_TRUE
+    };
+    if (m_hasPresentWait) {
+        m_deviceExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+        m_deviceExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+        featureChainHead = &presentWaitFeatures;
+    }
+
     vk::PhysicalDeviceFeatures2 deviceFeatures2{
         .pNext = featureChainHead,
         .features = deviceFeatures
@@ -119,6 +119,16 @@ void VulkanRHISwapchain::present(rhi::RHISemaphore* waitSemaphore /* = nullptr *
     presentInfo.pSwapchains = &(*m_swapchain);
     presentInfo.pImageIndices = &m_currentImageIndex;
 
+    // Tag the present so waitForPresent() can tell when it reaches the display
+    uint64_t presentId = m_lastPresentId + 1;
+    vk::PresentIdKHR presentIdInfo;
+    presentIdInfo.swapchainCount = 1;
+    presentIdInfo.pPresentIds = &presentId;
+    if (supportsPresentWait()) {
+        presentInfo.pNext = &presentIdInfo;
+        m_lastPresentId = presentId;
+    }
+
     vk::Result result = vulkanQueue->getVkQueue().presentKHR(presentInfo);
 
     if (result == vk::Result::eErrorOutOfDateKHR || result == vk::Result::eSuboptimalKHR) {
@@ -129,6 +139,23 @@ void VulkanRHISwapchain::present(rhi::RHISemaphore* waitSemaphore /* = nullptr *
     }
 }
 
+bool VulkanRHISwapchain::supportsPresentWait() const {
+    return m_device->hasPresentWaitSupport();
+}
+
+bool VulkanRHISwapchain::waitForPresent(uint64_t presentId, uint64_t timeoutNs) {
+    if (!supportsPresentWait() || presentId == 0 || presentId > m_lastPresentId) {
+        return false;
+    }
+
+    try {
+        vk::Result result = m_swapchain.waitForPresent(presentId, timeoutNs);
+        return result == vk::Result::eSuccess || result == vk::Result::eSuboptimalKHR;
+    } catch (const vk::SystemError&) {
+        return false;  // Out of date or surface lost; the next present recreates the swapchain
+    }
+}
+
 void VulkanRHISwapchain::resize(uint32_t width, uint32_t height) {
     m_extent.width = width;
     m_extent.height = height;
@@ -255,9 +282,10 @@ void VulkanRHISwapchain::recreate() {
     // Clean up old resources
     cleanup();
 
-    // Recreate swapchain
+    // Recreate swapchain (present IDs restart with the new swapchain)
     createSwapchain();
     createImageViews();
+    m_lastPresentId = 0;
 }
 
 // ============================================================================
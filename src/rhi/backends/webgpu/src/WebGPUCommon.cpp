@@ -401,6 +401,8 @@ WGPUVertexFormat ToWGPUVertexFormat(rhi::TextureFormat format) {
         case rhi::TextureFormat::R16Float:   return WGPUVertexFormat_Float16x2; // Closest match
         case rhi::TextureFormat::RG16Float:  return WGPUVertexFormat_Float16x2;
         case rhi::TextureFormat::RGBA16Float:return WGPUVertexFormat_Float16x4;
+        case rhi::TextureFormat::RG16Uint:   return WGPUVertexFormat_Uint16x2;
+        case rhi::TextureFormat::RGBA16Uint: return WGPUVertexFormat_Uint16x4;
         case rhi::TextureFormat::R32Float:   return WGPUVertexFormat_Float32;
         case rhi::TextureFormat::RG32Float:  return WGPUVertexFormat_Float32x2;
         case rhi::TextureFormat::RGB32Float: return WGPUVertexFormat_Float32x3;
@@ -128,6 +128,28 @@ public:
      * This should be called after swapchain creation/resize and before rendering.
      */
     virtual void ensureRenderResourcesReady(RHITextureView* depthView = nullptr) = 0;
+
+    // ========== Present timing (optional) ==========
+
+    /**
+     * @brief Whether presents carry IDs that waitForPresent() can wait on
+     *
+     * Vulkan: VK_KHR_present_id + VK_KHR_present_wait. Other backends return false.
+     */
+    virtual bool supportsPresentWait() const { return false; }
+
+    /**
+     * @brief ID of the most recent present() (0 before the first present or if unsupported)
+     */
+    virtual uint64_t getLastPresentId() const { return 0; }
+
+    /**
+     * @brief Block until the present with the given ID has been displayed
+     * @param presentId ID returned by getLastPresentId() after a present()
+     * @param timeoutNs Maximum wait in nanoseconds
+     * @return True if the image reached the display before the timeout
+     */
+    virtual bool waitForPresent(uint64_t presentId, uint64_t timeoutNs) { return false; }
 };
 
 } // namespace rhi
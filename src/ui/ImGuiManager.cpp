@@ -2,6 +2,8 @@
 #include "ImGuiVulkanBackend.hpp"
 #include "src/effects/ParticleSystem.hpp"
 #include <imgui.h>
+#include <algorithm>
+#include <ctime>
 #include <stdexcept>
 
 ImGuiManager::ImGuiManager(GLFWwindow* window,
@@ -107,6 +109,196 @@ void ImGuiManager::renderUI(Camera& camera, uint32_t buildingCount,
             ImGui::Separator();
             ImGui::Text("Active Particles: %u", particleSystem->getTotalActiveParticles());
             ImGui::Text("Emitters: %zu", particleSystem->getEmitterCount());
+            const auto& cullingStats = particleSystem->getCullingStats();
+            ImGui::Text("  Visible: %u  Culled: %u  Distant: %u",
+                        cullingStats.visibleEmitters, cullingStats.culledEmitters,
+                        cullingStats.distantEmitters);
+            const auto& budgetStats = particleSystem->getBudgetStats();
+            const auto& budget = particleSystem->getBudgetSettings();
+            ImGui::Text("Budget: %u/%u particles  %u/%u emitters  %.2f/%.1f fill",
+                        budgetStats.reservedParticles, budget.maxParticles,
+                        budgetStats.emitters, budget.maxEmitters,
+                        budgetStats.fillScreens, budget.maxFillScreens);
+            ImGui::Text("  Merged: %u  Shrunk: %u  Dropped: %u  Evicted: %u",
+                        budgetStats.merged, budgetStats.shrunk, budgetStats.dropped, budgetStats.evicted);
+        }
+    }
+
+    ImGui::Separator();
+
+    // Market data recording/replay
+    if (ImGui::CollapsingHeader("Market Replay")) {
+        using Action = ReplayRequest::Action;
+        ImGui::InputText("Tick File", m_tickFilePath, sizeof(m_tickFilePath));
+
+        if (!m_replayStatus.recording) {
+            if (ImGui::Button("Record")) {
+                m_replayRequest.action = Action::StartRecording;
+                m_replayRequest.path = m_tickFilePath;
+            }
+        } else if (ImGui::Button("Stop Recording")) {
+            m_replayRequest.action = Action::StopRecording;
+        }
+        ImGui::SameLine();
+        ImGui::Text("Recorded: %llu ticks", static_cast<unsigned long long>(m_replayStatus.recordedTicks));
+
+        const char* speedNames[] = { "1x", "10x", "100x", "Max" };
+        const float speeds[] = { 1.0f, 10.0f, 100.0f, 0.0f };
+        if (ImGui::Combo("Speed", &m_replaySpeedIndex, speedNames, 4)) {
+            m_replayRequest.action = Action::SetSpeed;
+        }
+        m_replayRequest.speed = speeds[m_replaySpeedIndex];
+
+        if (!m_replayStatus.replaying) {
+            if (ImGui::Button("Replay")) {
+                m_replayRequest.action = Action::StartReplay;
+                m_replayRequest.path = m_tickFilePath;
+            }
+        } else {
+            if (ImGui::Button("Stop Replay")) {
+                m_replayRequest.action = Action::StopReplay;
+            }
+            float position = m_replayStatus.progress;
+            if (ImGui::SliderFloat("Position", &position, 0.0f, 1.0f, "%.3f")) {
+                m_replayRequest.action = Action::Seek;
+                m_replayRequest.seekFraction = position;
+            }
+            ImGui::Text("Replayed: %llu ticks", static_cast<unsigned long long>(m_replayStatus.replayedTicks));
+        }
+    }
+
+    ImGui::Separator();
+
+    // Network market-data feed (tools/feed_server or a real gateway)
+    if (ImGui::CollapsingHeader("Market Feed")) {
+        using Action = FeedRequest::Action;
+        ImGui::InputText("Endpoint", m_feedEndpoint, sizeof(m_feedEndpoint));
+
+        if (!m_feedStatus.running) {
+            if (ImGui::Button("Connect")) {
+                m_feedRequest.action = Action::Connect;
+                m_feedRequest.endpoint = m_feedEndpoint;
+            }
+        } else {
+            if (ImGui::Button("Disconnect")) {
+                m_feedRequest.action = Action::Disconnect;
+            }
+            ImGui::SameLine();
+            ImGui::Text("%s", !m_feedStatus.connected ? "Connecting..."
+                              : m_feedStatus.throttled ? "Connected (throttled)" : "Connected");
+        }
+
+        ImGui::Text("Received: %.1f MiB, %llu ticks", m_feedStatus.bytesReceived / (1024.0 * 1024.0),
+                    static_cast<unsigned long long>(m_feedStatus.ticks));
+        ImGui::Text("Rejected: %llu  Throttle events: %llu",
+                    static_cast<unsigned long long>(m_feedStatus.rejected),
+                    static_cast<unsigned long long>(m_feedStatus.throttleEvents));
+    }
+
+    ImGui::Separator();
+
+    // Price-to-photon latency breakdown
+    if (ImGui::CollapsingHeader("Latency")) {
+        using Action = LatencyRequest::Action;
+
+        for (const auto& stage : m_latencyStats.stages) {
+            ImGui::Text("%-17s p50 %7.2f  p99 %7.2f  max %7.2f ms  (%llu)", stage.name,
+                        stage.p50Ms, stage.p99Ms, stage.maxMs, static_cast<unsigned long long>(stage.count));
+        }
+
+        if (m_latencyStats.presentWaitSupported) {
+            bool presentWait = m_latencyStats.presentWaitEnabled;
+            if (ImGui::Checkbox("Present Wait (display time, paces frames)", &presentWait)) {
+                m_latencyRequest.action = Action::SetPresentWait;
+                m_latencyRequest.presentWait = presentWait;
+            }
+        } else {
+            ImGui::TextDisabled("Present wait unavailable: present = present call returned");
+        }
+
+        if (ImGui::Button("Reset")) {
+            m_latencyRequest.action = Action::Reset;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Export")) {
+            m_latencyRequest.action = Action::Export;
+            m_latencyRequest.path = m_latencyReportPath;
+        }
+        ImGui::SameLine();
+        ImGui::InputText("##LatencyReport", m_latencyReportPath, sizeof(m_latencyReportPath));
+    }
+
+    ImGui::Separator();
+
+    // Per-sector aggregates (maintained incrementally by BuildingManager)
+    if (ImGui::CollapsingHeader("Sectors")) {
+        if (m_sectorStats.rows.empty()) {
+            ImGui::TextDisabled("No sectors");
+        }
+        for (const auto& row : m_sectorStats.rows) {
+            ImGui::Text("%s  (%u buildings)  avg $%.2f", row.name.c_str(), row.buildingCount, row.averagePrice);
+            ImGui::Text("  Change: %+.2f%%  Vol-weighted: %+.2f%%  Up/Down: %u/%u",
+                        row.averageChangePercent, row.volumeWeightedChangePercent, row.advancers, row.decliners);
+            if (!row.topGainer.empty()) {
+                ImGui::Text("  Top: %s %+.2f%%  Bottom: %s %+.2f%%",
+                            row.topGainer.c_str(), row.topGainerChangePercent,
+                            row.topLoser.c_str(), row.topLoserChangePercent);
+            }
+        }
+    }
+
+    ImGui::Separator();
+
+    // Rewind the city: keyframe + delta price history
+    if (ImGui::CollapsingHeader("Timeline")) {
+        using Action = TimelineRequest::Action;
+        const TimelineStatus& status = m_timelineStatus;
+
+        if (status.newestTime == 0) {
+            ImGui::TextDisabled("Nothing recorded yet");
+        } else {
+            float range = static_cast<float>(status.newestTime - status.oldestTime) / 1000.0f;
+            if (ImGui::SliderFloat("Seconds Ago", &m_timelineSecondsAgo, range, 0.0f, "%.1f s")) {
+                uint64_t offset = static_cast<uint64_t>(m_timelineSecondsAgo * 1000.0f);
+                m_timelineRequest.action = Action::Scrub;
+                m_timelineRequest.timestamp = status.newestTime - std::min(offset, status.newestTime);
+            }
+
+            if (status.scrubbing) {
+                std::time_t shown = static_cast<std::time_t>(status.shownTime / 1000);
+                char clock[16] = "";
+                std::strftime(clock, sizeof(clock), "%H:%M:%S", std::localtime(&shown));
+                ImGui::Text("Showing %s", clock);
+                ImGui::SameLine();
+                if (ImGui::Button("Live")) {
+                    m_timelineRequest.action = Action::Live;
+                    m_timelineSecondsAgo = 0.0f;
+                }
+            } else {
+                ImGui::Text("Live");
+            }
+        }
+
+        ImGui::Text("Keyframes: %zu  Frames: %zu  Deltas: %zu", status.keyframes, status.frames, status.deltas);
+        ImGui::Text("Memory: %.1f / %.1f MiB", status.memoryBytes / (1024.0 * 1024.0),
+                    status.memoryBudget / (1024.0 * 1024.0));
+        ImGui::Text("Last rebuild: %.2f ms (%zu deltas)", status.reconstructMs, status.reconstructDeltas);
+    }
+
+    ImGui::Separator();
+
+    // Binary world snapshot (also autosaved by Application)
+    if (ImGui::CollapsingHeader("World Snapshot")) {
+        using Action = SnapshotRequest::Action;
+        ImGui::InputText("Snapshot", m_snapshotPath, sizeof(m_snapshotPath));
+        if (ImGui::Button("Save World")) {
+            m_snapshotRequest.action = Action::Save;
+            m_snapshotRequest.path = m_snapshotPath;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Load World")) {
+            m_snapshotRequest.action = Action::Load;
+            m_snapshotRequest.path = m_snapshotPath;
         }
     }
 
@@ -207,6 +399,24 @@ void ImGuiManager::renderUI(Camera& camera, uint32_t buildingCount,
         ImGui::Text("  Main Pass:    %.3f ms", m_gpuTiming.mainPassMs);
         float gpuTotal = m_gpuTiming.cullingMs + m_gpuTiming.shadowMs + m_gpuTiming.mainPassMs;
         ImGui::Text("  GPU Total:    %.3f ms", gpuTotal);
+
+        // CPU-side per-frame work
+        if (particleSystem) {
+            const auto& sortStats = particleSystem->getSortStats();
+            ImGui::Separator();
+            ImGui::Text("CPU Timings:");
+            ImGui::Text("  Particle Sort: %.3f ms (%u alpha)", sortStats.cpuMs, sortStats.sortedCount);
+        }
+
+        // Market data ingestion
+        ImGui::Separator();
+        ImGui::Text("Market Data:");
+        ImGui::Text("  Queue Depth: %u  Last Drain: %u symbols",
+                    m_marketDataStats.queueDepth, m_marketDataStats.lastDrainSymbols);
+        ImGui::Text("  Pushed: %llu  Coalesced: %llu  Dropped: %llu",
+                    static_cast<unsigned long long>(m_marketDataStats.pushed),
+                    static_cast<unsigned long long>(m_marketDataStats.coalesced),
+                    static_cast<unsigned long long>(m_marketDataStats.dropped));
     }
 
     // Demo window toggle
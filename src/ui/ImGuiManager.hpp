@@ -6,9 +6,11 @@
 #include "src/effects/Particle.hpp"
 
 #include <GLFW/glfw3.h>
+#include <array>
 #include <functional>
 #include <string>
 #include <memory>
+#include <vector>
 
 // Forward declaration
 namespace effects {
@@ -80,6 +82,162 @@ public:
 
     void setGpuTimingData(const GpuTimingData& data) { m_gpuTiming = data; }
 
+    // Market data ingestion counters (passed from Application)
+    struct MarketDataStats {
+        uint32_t queueDepth = 0;
+        uint32_t lastDrainSymbols = 0;
+        uint64_t pushed = 0;
+        uint64_t dropped = 0;
+        uint64_t coalesced = 0;
+    };
+
+    void setMarketDataStats(const MarketDataStats& stats) { m_marketDataStats = stats; }
+
+    // Tick recording/replay request (set by UI, read by Application)
+    struct ReplayRequest {
+        enum class Action { None, StartRecording, StopRecording, StartReplay, StopReplay, SetSpeed, Seek };
+        Action action = Action::None;
+        std::string path;
+        float speed = 1.0f;             // Replay speed multiplier (0 = as fast as possible)
+        float seekFraction = 0.0f;      // Seek target within the recording [0, 1]
+    };
+
+    ReplayRequest getAndClearReplayRequest() {
+        ReplayRequest req = m_replayRequest;
+        m_replayRequest.action = ReplayRequest::Action::None;
+        return req;
+    }
+
+    // Tick recording/replay state (passed from Application)
+    struct ReplayStatus {
+        bool recording = false;
+        uint64_t recordedTicks = 0;
+        bool replaying = false;
+        float progress = 0.0f;
+        uint64_t replayedTicks = 0;
+    };
+
+    void setReplayStatus(const ReplayStatus& status) { m_replayStatus = status; }
+
+    // Network feed connect/disconnect request (set by UI, read by Application)
+    struct FeedRequest {
+        enum class Action { None, Connect, Disconnect };
+        Action action = Action::None;
+        std::string endpoint;           // "tcp://host:port" or "unix:///path"
+    };
+
+    FeedRequest getAndClearFeedRequest() {
+        FeedRequest req = m_feedRequest;
+        m_feedRequest.action = FeedRequest::Action::None;
+        return req;
+    }
+
+    // Network feed state (passed from Application)
+    struct FeedStatus {
+        bool running = false;           // Ingestion thread started
+        bool connected = false;
+        bool throttled = false;         // Socket reads paused by queue backpressure
+        uint64_t bytesReceived = 0;
+        uint64_t ticks = 0;
+        uint64_t rejected = 0;
+        uint64_t throttleEvents = 0;
+    };
+
+    void setFeedStatus(const FeedStatus& status) { m_feedStatus = status; }
+
+    // Price-to-photon latency (passed from Application)
+    struct LatencyStats {
+        struct Stage {
+            const char* name = "";
+            uint64_t count = 0;
+            float p50Ms = 0.0f;
+            float p99Ms = 0.0f;
+            float maxMs = 0.0f;
+        };
+        std::array<Stage, 3> stages;    // feed->simulate, simulate->submit, submit->present
+        bool presentWaitSupported = false;
+        bool presentWaitEnabled = false;
+    };
+
+    void setLatencyStats(const LatencyStats& stats) { m_latencyStats = stats; }
+
+    // Per-sector market aggregates (passed from Application when they change)
+    struct SectorStats {
+        struct Row {
+            std::string name;
+            uint32_t buildingCount = 0;
+            float averagePrice = 0.0f;
+            float averageChangePercent = 0.0f;
+            float volumeWeightedChangePercent = 0.0f;
+            uint32_t advancers = 0;
+            uint32_t decliners = 0;
+            std::string topGainer;
+            float topGainerChangePercent = 0.0f;
+            std::string topLoser;
+            float topLoserChangePercent = 0.0f;
+        };
+        std::vector<Row> rows;
+    };
+
+    void setSectorStats(SectorStats stats) { m_sectorStats = std::move(stats); }
+
+    // Latency panel request (set by UI, read by Application)
+    struct LatencyRequest {
+        enum class Action { None, Reset, Export, SetPresentWait };
+        Action action = Action::None;
+        std::string path;               // Export: report file
+        bool presentWait = false;       // SetPresentWait
+    };
+
+    LatencyRequest getAndClearLatencyRequest() {
+        LatencyRequest req = m_latencyRequest;
+        m_latencyRequest.action = LatencyRequest::Action::None;
+        return req;
+    }
+
+    // World snapshot save/load request (set by UI, read by Application)
+    struct SnapshotRequest {
+        enum class Action { None, Save, Load };
+        Action action = Action::None;
+        std::string path;
+    };
+
+    SnapshotRequest getAndClearSnapshotRequest() {
+        SnapshotRequest req = m_snapshotRequest;
+        m_snapshotRequest.action = SnapshotRequest::Action::None;
+        return req;
+    }
+
+    // World timeline scrub request (set by UI, read by Application)
+    struct TimelineRequest {
+        enum class Action { None, Scrub, Live };
+        Action action = Action::None;
+        uint64_t timestamp = 0;         // Scrub: target time (milliseconds since epoch)
+    };
+
+    TimelineRequest getAndClearTimelineRequest() {
+        TimelineRequest req = m_timelineRequest;
+        m_timelineRequest.action = TimelineRequest::Action::None;
+        return req;
+    }
+
+    // World timeline state (passed from Application)
+    struct TimelineStatus {
+        uint64_t oldestTime = 0;        // 0 = nothing recorded yet
+        uint64_t newestTime = 0;
+        bool scrubbing = false;
+        uint64_t shownTime = 0;         // State on screen while scrubbing
+        size_t keyframes = 0;
+        size_t frames = 0;
+        size_t deltas = 0;
+        size_t memoryBytes = 0;
+        size_t memoryBudget = 0;
+        float reconstructMs = 0.0f;
+        size_t reconstructDeltas = 0;
+    };
+
+    void setTimelineStatus(const TimelineStatus& status) { m_timelineStatus = status; }
+
     // Phase 4.1: Stress test — building count change request
     struct ScaleRequest {
         bool requested = false;
@@ -111,6 +269,35 @@ private:
 
     // Phase 4.1: GPU profiling
     GpuTimingData m_gpuTiming;
+    MarketDataStats m_marketDataStats;
+
+    // Tick recording/replay UI state
+    char m_tickFilePath[256] = "market.ticks";
+    int m_replaySpeedIndex = 0;
+    ReplayRequest m_replayRequest;
+    ReplayStatus m_replayStatus;
+
+    // Network feed UI state
+    char m_feedEndpoint[256] = "tcp://127.0.0.1:9000";
+    FeedRequest m_feedRequest;
+    FeedStatus m_feedStatus;
+
+    // Latency UI state
+    char m_latencyReportPath[256] = "latency.csv";
+    LatencyStats m_latencyStats;
+    LatencyRequest m_latencyRequest;
+
+    // Sector UI state
+    SectorStats m_sectorStats;
+
+    // World timeline UI state
+    float m_timelineSecondsAgo = 0.0f;
+    TimelineRequest m_timelineRequest;
+    TimelineStatus m_timelineStatus;
+
+    // World snapshot UI state
+    char m_snapshotPath[256] = "world.snapshot";
+    SnapshotRequest m_snapshotRequest;
 
     // Phase 4.1: Stress test
     int m_targetBuildingCount = 16;
@@ -0,0 +1,137 @@
+#include "LatencyTracer.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+
+// ============================================================================
+// LatencyHistogram
+// ============================================================================
+
+uint32_t LatencyHistogram::bucketOf(uint64_t valueNs) {
+    if (valueNs < LINEAR_LIMIT) {
+        return static_cast<uint32_t>(valueNs);
+    }
+    uint32_t octave = static_cast<uint32_t>(std::bit_width(valueNs)) - 1;   // >= 4
+    uint32_t sub = static_cast<uint32_t>(valueNs >> (octave - SUB_BUCKET_BITS)) & ((1u << SUB_BUCKET_BITS) - 1);
+    return LINEAR_LIMIT + ((octave - 4) << SUB_BUCKET_BITS) + sub;
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(uint32_t bucket) {
+    if (bucket < LINEAR_LIMIT) {
+        return bucket;
+    }
+    uint32_t octave = ((bucket - LINEAR_LIMIT) >> SUB_BUCKET_BITS) + 4;
+    uint64_t sub = (bucket - LINEAR_LIMIT) & ((1u << SUB_BUCKET_BITS) - 1);
+    return ((1ull << SUB_BUCKET_BITS) + sub) << (octave - SUB_BUCKET_BITS);
+}
+
+void LatencyHistogram::record(uint64_t valueNs, uint64_t samples) {
+    buckets[bucketOf(valueNs)] += samples;
+    count += samples;
+    maxValue = std::max(maxValue, valueNs);
+}
+
+void LatencyHistogram::reset() {
+    buckets.fill(0);
+    count = 0;
+    maxValue = 0;
+}
+
+uint64_t LatencyHistogram::percentile(double fraction) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count))));
+    uint64_t seen = 0;
+    for (uint32_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= target) {
+            uint64_t lower = bucketLowerBound(bucket);
+            uint64_t upper = bucket + 1 < BUCKET_COUNT ? bucketLowerBound(bucket + 1) : lower;
+            // Never report more than the largest value actually seen
+            return std::min(lower + (upper - lower) / 2, maxValue);
+        }
+    }
+    return maxValue;
+}
+
+// ============================================================================
+// LatencyTracer
+// ============================================================================
+
+const char* LatencyTracer::stageName(Stage stage) {
+    switch (stage) {
+        case Stage::FeedToSimulate:   return "feed->simulate";
+        case Stage::SimulateToSubmit: return "simulate->submit";
+        case Stage::SubmitToPresent:  return "submit->present";
+        default:                      return "unknown";
+    }
+}
+
+void LatencyTracer::recordSince(Stage stage, uint64_t endTime, std::span<const uint64_t> startTimes) {
+    LatencyHistogram& histogram = histograms[static_cast<uint32_t>(stage)];
+
+    size_t i = 0;
+    while (i < startTimes.size()) {
+        uint64_t start = startTimes[i];
+        size_t runEnd = i + 1;
+        while (runEnd < startTimes.size() && startTimes[runEnd] == start) {
+            ++runEnd;
+        }
+        histogram.record(endTime > start ? endTime - start : 0, runEnd - i);
+        i = runEnd;
+    }
+}
+
+LatencyTracer::Summary LatencyTracer::getSummary(Stage stage) const {
+    const LatencyHistogram& histogram = histograms[static_cast<uint32_t>(stage)];
+    Summary summary;
+    summary.count = histogram.getCount();
+    summary.p50Ms = static_cast<float>(histogram.percentile(0.50) / 1e6);
+    summary.p99Ms = static_cast<float>(histogram.percentile(0.99) / 1e6);
+    summary.maxMs = static_cast<float>(histogram.getMax() / 1e6);
+    return summary;
+}
+
+void LatencyTracer::reset() {
+    for (auto& histogram : histograms) {
+        histogram.reset();
+    }
+}
+
+bool LatencyTracer::writeReport(const std::string& path) const {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        LOG_ERROR("Latency") << "Failed to open " << path;
+        return false;
+    }
+
+    out << "# summary\nstage,count,p50_ms,p99_ms,max_ms\n";
+    for (uint32_t s = 0; s < static_cast<uint32_t>(Stage::Count); ++s) {
+        Summary summary = getSummary(static_cast<Stage>(s));
+        out << stageName(static_cast<Stage>(s)) << ',' << summary.count << ',' << summary.p50Ms << ','
+            << summary.p99Ms << ',' << summary.maxMs << '\n';
+    }
+
+    out << "# histogram\nstage,bucket_lower_us,count\n";
+    for (uint32_t s = 0; s < static_cast<uint32_t>(Stage::Count); ++s) {
+        const LatencyHistogram& histogram = histograms[s];
+        for (uint32_t bucket = 0; bucket < LatencyHistogram::BUCKET_COUNT; ++bucket) {
+            if (histogram.getBucketCount(bucket) > 0) {
+                out << stageName(static_cast<Stage>(s)) << ','
+                    << LatencyHistogram::bucketLowerBound(bucket) / 1e3 << ','
+                    << histogram.getBucketCount(bucket) << '\n';
+            }
+        }
+    }
+
+    if (!out) {
+        LOG_ERROR("Latency") << "Failed to write " << path;
+        return false;
+    }
+    LOG_INFO("Latency") << "Wrote latency report to " << path;
+    return true;
+}
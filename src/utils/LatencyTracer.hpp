@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace latency {
+
+/**
+ * @brief Monotonic timestamp in nanoseconds used by every latency stage
+ */
+inline uint64_t now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace latency
+
+/**
+ * @brief Log-linear latency histogram (8 sub-buckets per power of two)
+ *
+ * Values below 16 ns get exact buckets; above that each octave is split
+ * into 8 linear buckets, so a percentile is within 12.5% of the true value
+ * while recording stays a bit scan and an increment. The maximum is exact.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 3;
+    static constexpr uint32_t LINEAR_LIMIT = 16;
+    static constexpr uint32_t BUCKET_COUNT = LINEAR_LIMIT + (64 - 4) * (1u << SUB_BUCKET_BITS);
+
+    void record(uint64_t valueNs, uint64_t count = 1);
+    void reset();
+
+    uint64_t getCount() const { return count; }
+    uint64_t getMax() const { return maxValue; }
+
+    /**
+     * @brief Value at or below which the given fraction of samples fall
+     * @param fraction In [0, 1] (0.5 = median, 0.99 = p99)
+     * @return Bucket midpoint in nanoseconds (0 if empty)
+     */
+    uint64_t percentile(double fraction) const;
+
+    static uint32_t bucketOf(uint64_t valueNs);
+    static uint64_t bucketLowerBound(uint32_t bucket);
+    uint64_t getBucketCount(uint32_t bucket) const { return buckets[bucket]; }
+
+private:
+    std::array<uint64_t, BUCKET_COUNT> buckets{};
+    uint64_t count = 0;
+    uint64_t maxValue = 0;
+};
+
+/**
+ * @brief Price-to-photon latency breakdown
+ *
+ * Three stages of a tick's trip to the screen, all on latency::now():
+ *   FeedToSimulate   - ingestion into MarketDataQueue -> applied to its building
+ *   SimulateToSubmit - applied -> GPU submit of the frame that uploaded it
+ *   SubmitToPresent  - frame submit -> displayed (present wait) or present returned
+ *
+ * Owned and fed by the frame loop; not thread-safe.
+ */
+class LatencyTracer {
+public:
+    enum class Stage : uint32_t {
+        FeedToSimulate = 0,
+        SimulateToSubmit = 1,
+        SubmitToPresent = 2,
+        Count = 3
+    };
+
+    static const char* stageName(Stage stage);
+
+    void record(Stage stage, uint64_t latencyNs, uint64_t count = 1) {
+        histograms[static_cast<uint32_t>(stage)].record(latencyNs, count);
+    }
+
+    /**
+     * @brief Record endTime - start for every start time
+     *
+     * Runs of equal start times (ticks applied in the same batch) are
+     * recorded as one weighted sample. Starts after endTime count as 0.
+     */
+    void recordSince(Stage stage, uint64_t endTime, std::span<const uint64_t> startTimes);
+
+    struct Summary {
+        uint64_t count = 0;
+        float p50Ms = 0.0f;
+        float p99Ms = 0.0f;
+        float maxMs = 0.0f;
+    };
+    Summary getSummary(Stage stage) const;
+
+    const LatencyHistogram& getHistogram(Stage stage) const {
+        return histograms[static_cast<uint32_t>(stage)];
+    }
+
+    void reset();
+
+    /**
+     * @brief Write per-stage summaries and non-empty buckets as CSV
+     * @return False if the file could not be written
+     */
+    bool writeReport(const std::string& path) const;
+
+private:
+    std::array<LatencyHistogram, static_cast<size_t>(Stage::Count)> histograms;
+};
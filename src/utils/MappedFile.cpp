@@ -0,0 +1,156 @@
+#include "MappedFile.hpp"
+#include "Logger.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_fd(std::exchange(other.m_fd, -1))
+    , m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+    , m_writable(std::exchange(other.m_writable, false))
+    , m_path(std::move(other.m_path))
+{}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        m_fd = std::exchange(other.m_fd, -1);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_writable = std::exchange(other.m_writable, false);
+        m_path = std::move(other.m_path);
+    }
+    return *this;
+}
+
+bool MappedFile::openRead(const std::string& path) {
+    close();
+
+    m_fd = ::open(path.c_str(), O_RDONLY);
+    if (m_fd < 0) {
+        LOG_ERROR("MappedFile") << "Failed to open " << path << ": " << std::strerror(errno);
+        return false;
+    }
+
+    struct stat info;
+    if (::fstat(m_fd, &info) != 0 || info.st_size <= 0) {
+        LOG_ERROR("MappedFile") << "Empty or unreadable file: " << path;
+        close();
+        return false;
+    }
+
+    m_path = path;
+    m_writable = false;
+    return map(static_cast<size_t>(info.st_size));
+}
+
+bool MappedFile::create(const std::string& path, size_t initialSize) {
+    close();
+
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (m_fd < 0) {
+        LOG_ERROR("MappedFile") << "Failed to create " << path << ": " << std::strerror(errno);
+        return false;
+    }
+
+    m_path = path;
+    m_writable = true;
+    if (::ftruncate(m_fd, static_cast<off_t>(initialSize)) != 0) {
+        LOG_ERROR("MappedFile") << "Failed to size " << path << ": " << std::strerror(errno);
+        close(0);
+        return false;
+    }
+    return map(initialSize);
+}
+
+bool MappedFile::resize(size_t newSize) {
+    if (!m_writable || m_fd < 0) {
+        return false;
+    }
+
+    ::munmap(m_data, m_size);
+    m_data = nullptr;
+
+    if (::ftruncate(m_fd, static_cast<off_t>(newSize)) != 0) {
+        LOG_ERROR("MappedFile") << "Failed to resize " << m_path << " to " << newSize
+                                << " bytes: " << std::strerror(errno);
+        // Keep the previous mapping usable
+        map(m_size);
+        return false;
+    }
+    return map(newSize);
+}
+
+void MappedFile::flush() {
+    if (m_writable && m_data) {
+        ::msync(m_data, m_size, MS_ASYNC);
+    }
+}
+
+bool MappedFile::sync() {
+    if (!m_writable || !m_data) {
+        return false;
+    }
+    if (::msync(m_data, m_size, MS_SYNC) != 0 || ::fsync(m_fd) != 0) {
+        LOG_ERROR("MappedFile") << "Failed to sync " << m_path << ": " << std::strerror(errno);
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::syncParentDirectory(const std::string& path) {
+    size_t slash = path.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0 || ::fsync(fd) != 0) {
+        LOG_ERROR("MappedFile") << "Failed to sync directory " << directory << ": " << std::strerror(errno);
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        return false;
+    }
+    ::close(fd);
+    return true;
+}
+
+void MappedFile::close(size_t finalSize) {
+    if (m_data) {
+        ::munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+    if (m_fd >= 0) {
+        if (m_writable && finalSize != SIZE_MAX) {
+            if (::ftruncate(m_fd, static_cast<off_t>(finalSize)) != 0) {
+                LOG_WARN("MappedFile") << "Failed to truncate " << m_path << ": " << std::strerror(errno);
+            }
+        }
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+    m_writable = false;
+}
+
+bool MappedFile::map(size_t size) {
+    int protection = m_writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* address = ::mmap(nullptr, size, protection, MAP_SHARED, m_fd, 0);
+    if (address == MAP_FAILED) {
+        LOG_ERROR("MappedFile") << "Failed to map " << m_path << ": " << std::strerror(errno);
+        close();
+        return false;
+    }
+    m_data = static_cast<std::byte*>(address);
+    m_size = size;
+    return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Memory-mapped file (POSIX mmap)
+ *
+ * Read mode maps an existing file read-only. Write mode creates/truncates
+ * the file, maps it shared and lets the owner grow it with resize(); the
+ * mapping moves on resize, so callers keep offsets rather than pointers.
+ * close() optionally truncates a written file to its used length.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Map an existing file read-only
+     * @return False (and logs) if the file cannot be opened or mapped
+     */
+    bool openRead(const std::string& path);
+
+    /**
+     * @brief Create or truncate a file and map it writable
+     * @param initialSize Initial mapped length in bytes (> 0)
+     */
+    bool create(const std::string& path, size_t initialSize);
+
+    /**
+     * @brief Grow or shrink a writable mapping (contents up to the new size are kept)
+     */
+    bool resize(size_t newSize);
+
+    /**
+     * @brief Schedule dirty pages for write-back (writable mappings)
+     */
+    void flush();
+
+    /**
+     * @brief Write dirty pages and file metadata to disk, blocking until done
+     * @return False if either step failed
+     */
+    bool sync();
+
+    /**
+     * @brief Sync the directory holding path, so a rename into it survives a crash
+     * @return False (and logs) if the directory cannot be opened or synced
+     */
+    static bool syncParentDirectory(const std::string& path);
+
+    /**
+     * @brief Unmap and close
+     * @param finalSize For writable files, truncate to this length (SIZE_MAX keeps the mapped length)
+     */
+    void close(size_t finalSize = SIZE_MAX);
+
+    bool isOpen() const { return m_data != nullptr; }
+    bool isWritable() const { return m_writable; }
+
+    std::byte* data() { return m_data; }
+    const std::byte* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    bool map(size_t size);
+
+    int m_fd = -1;
+    std::byte* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_writable = false;
+    std::string m_path;
+};
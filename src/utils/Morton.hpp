@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file Morton.hpp
+ * @brief Z-order (Morton) codes for 2D grid coordinates
+ *
+ * Interleaving the bits of two coordinates gives a 1D key whose sort order
+ * keeps most grid neighbours close together, at every scale.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace morton {
+
+/**
+ * @brief Spread the low 16 bits of v so bit i lands at bit 2i
+ */
+inline constexpr uint32_t part1By1(uint32_t v) {
+    v &= 0x0000FFFFu;
+    v = (v | (v << 8)) & 0x00FF00FFu;
+    v = (v | (v << 4)) & 0x0F0F0F0Fu;
+    v = (v | (v << 2)) & 0x33333333u;
+    v = (v | (v << 1)) & 0x55555555u;
+    return v;
+}
+
+/**
+ * @brief Interleave two 16-bit coordinates (x in even bits, y in odd bits)
+ */
+inline constexpr uint32_t encode2D(uint32_t x, uint32_t y) {
+    return part1By1(x) | (part1By1(y) << 1);
+}
+
+/**
+ * @brief Morton code of a world-space XZ position on a grid of cellSize cells
+ *
+ * The grid is centered on the origin and covers +/-32768 cells per axis;
+ * positions outside clamp to the border.
+ */
+inline uint32_t encodeWorldXZ(float x, float z, float cellSize) {
+    auto quantize = [cellSize](float value) {
+        float cell = std::floor(value / cellSize) + 32768.0f;
+        return static_cast<uint32_t>(std::clamp(cell, 0.0f, 65535.0f));
+    };
+    return encode2D(quantize(x), quantize(z));
+}
+
+} // namespace morton
@@ -0,0 +1,195 @@
+#pragma once
+
+/**
+ * @file Simd.hpp
+ * @brief Minimal portable float SIMD wrapper
+ *
+ * simd::Float is the widest float vector enabled for the target:
+ *   AVX2 (8 lanes, when built with -mavx2 / ENABLE_AVX2), SSE2 (4 lanes),
+ *   NEON (4 lanes), WASM SIMD128 (4 lanes), otherwise scalar (1 lane).
+ *
+ * Loads and stores are unaligned. Loops over SoA streams step by
+ * simd::Float::Width; callers pad stream capacity to a multiple of
+ * simd::MaxWidth so no scalar tail loop is needed.
+ */
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define MINI_ENGINE_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define MINI_ENGINE_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define MINI_ENGINE_SIMD_NEON 1
+#elif defined(__wasm_simd128__)
+    #include <wasm_simd128.h>
+    #define MINI_ENGINE_SIMD_WASM 1
+#endif
+
+namespace simd {
+
+/**
+ * @brief Stream padding that satisfies every backend
+ */
+inline constexpr uint32_t MaxWidth = 8;
+
+/**
+ * @brief Round a count up to a multiple of MaxWidth
+ */
+inline constexpr uint32_t padCount(uint32_t count) {
+    return (count + MaxWidth - 1) & ~(MaxWidth - 1);
+}
+
+#if defined(MINI_ENGINE_SIMD_AVX2)
+
+struct Float {
+    static constexpr uint32_t Width = 8;
+    __m256 v;
+
+    Float() = default;
+    Float(__m256 value) : v(value) {}
+    explicit Float(float value) : v(_mm256_set1_ps(value)) {}
+
+    static Float load(const float* p) { return _mm256_loadu_ps(p); }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+
+    friend Float operator+(Float a, Float b) { return _mm256_add_ps(a.v, b.v); }
+    friend Float operator-(Float a, Float b) { return _mm256_sub_ps(a.v, b.v); }
+    friend Float operator*(Float a, Float b) { return _mm256_mul_ps(a.v, b.v); }
+    friend Float operator/(Float a, Float b) { return _mm256_div_ps(a.v, b.v); }
+    friend Float min(Float a, Float b) { return _mm256_min_ps(a.v, b.v); }
+    friend Float max(Float a, Float b) { return _mm256_max_ps(a.v, b.v); }
+    friend Float sqrt(Float a) { return _mm256_sqrt_ps(a.v); }
+    /** @brief a * b + c */
+    friend Float fma(Float a, Float b, Float c) {
+    #if defined(__FMA__)
+        return _mm256_fmadd_ps(a.v, b.v, c.v);
+    #else
+        return _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v);
+    #endif
+    }
+};
+
+#elif defined(MINI_ENGINE_SIMD_SSE2)
+
+struct Float {
+    static constexpr uint32_t Width = 4;
+    __m128 v;
+
+    Float() = default;
+    Float(__m128 value) : v(value) {}
+    explicit Float(float value) : v(_mm_set1_ps(value)) {}
+
+    static Float load(const float* p) { return _mm_loadu_ps(p); }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+
+    friend Float operator+(Float a, Float b) { return _mm_add_ps(a.v, b.v); }
+    friend Float operator-(Float a, Float b) { return _mm_sub_ps(a.v, b.v); }
+    friend Float operator*(Float a, Float b) { return _mm_mul_ps(a.v, b.v); }
+    friend Float operator/(Float a, Float b) { return _mm_div_ps(a.v, b.v); }
+    friend Float min(Float a, Float b) { return _mm_min_ps(a.v, b.v); }
+    friend Float max(Float a, Float b) { return _mm_max_ps(a.v, b.v); }
+    friend Float sqrt(Float a) { return _mm_sqrt_ps(a.v); }
+    /** @brief a * b + c */
+    friend Float fma(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v); }
+};
+
+#elif defined(MINI_ENGINE_SIMD_NEON)
+
+struct Float {
+    static constexpr uint32_t Width = 4;
+    float32x4_t v;
+
+    Float() = default;
+    Float(float32x4_t value) : v(value) {}
+    explicit Float(float value) : v(vdupq_n_f32(value)) {}
+
+    static Float load(const float* p) { return vld1q_f32(p); }
+    void store(float* p) const { vst1q_f32(p, v); }
+
+    friend Float operator+(Float a, Float b) { return vaddq_f32(a.v, b.v); }
+    friend Float operator-(Float a, Float b) { return vsubq_f32(a.v, b.v); }
+    friend Float operator*(Float a, Float b) { return vmulq_f32(a.v, b.v); }
+    friend Float operator/(Float a, Float b) {
+    #if defined(__aarch64__)
+        return vdivq_f32(a.v, b.v);
+    #else
+        // ARMv7: reciprocal estimate + two Newton-Raphson steps
+        float32x4_t reciprocal = vrecpeq_f32(b.v);
+        reciprocal = vmulq_f32(vrecpsq_f32(b.v, reciprocal), reciprocal);
+        reciprocal = vmulq_f32(vrecpsq_f32(b.v, reciprocal), reciprocal);
+        return vmulq_f32(a.v, reciprocal);
+    #endif
+    }
+    friend Float min(Float a, Float b) { return vminq_f32(a.v, b.v); }
+    friend Float max(Float a, Float b) { return vmaxq_f32(a.v, b.v); }
+    friend Float sqrt(Float a) {
+    #if defined(__aarch64__)
+        return vsqrtq_f32(a.v);
+    #else
+        // ARMv7: a * rsqrt(a) with two Newton-Raphson steps (0 stays 0)
+        float32x4_t estimate = vrsqrteq_f32(a.v);
+        estimate = vmulq_f32(vrsqrtsq_f32(vmulq_f32(a.v, estimate), estimate), estimate);
+        estimate = vmulq_f32(vrsqrtsq_f32(vmulq_f32(a.v, estimate), estimate), estimate);
+        float32x4_t result = vmulq_f32(a.v, estimate);
+        return vbslq_f32(vceqq_f32(a.v, vdupq_n_f32(0.0f)), a.v, result);
+    #endif
+    }
+    /** @brief a * b + c */
+    friend Float fma(Float a, Float b, Float c) { return vmlaq_f32(c.v, a.v, b.v); }
+};
+
+#elif defined(MINI_ENGINE_SIMD_WASM)
+
+struct Float {
+    static constexpr uint32_t Width = 4;
+    v128_t v;
+
+    Float() = default;
+    Float(v128_t value) : v(value) {}
+    explicit Float(float value) : v(wasm_f32x4_splat(value)) {}
+
+    static Float load(const float* p) { return wasm_v128_load(p); }
+    void store(float* p) const { wasm_v128_store(p, v); }
+
+    friend Float operator+(Float a, Float b) { return wasm_f32x4_add(a.v, b.v); }
+    friend Float operator-(Float a, Float b) { return wasm_f32x4_sub(a.v, b.v); }
+    friend Float operator*(Float a, Float b) { return wasm_f32x4_mul(a.v, b.v); }
+    friend Float operator/(Float a, Float b) { return wasm_f32x4_div(a.v, b.v); }
+    friend Float min(Float a, Float b) { return wasm_f32x4_min(a.v, b.v); }
+    friend Float max(Float a, Float b) { return wasm_f32x4_max(a.v, b.v); }
+    friend Float sqrt(Float a) { return wasm_f32x4_sqrt(a.v); }
+    /** @brief a * b + c */
+    friend Float fma(Float a, Float b, Float c) { return wasm_f32x4_add(wasm_f32x4_mul(a.v, b.v), c.v); }
+};
+
+#else
+
+struct Float {
+    static constexpr uint32_t Width = 1;
+    float v;
+
+    Float() = default;
+    explicit Float(float value) : v(value) {}
+
+    static Float load(const float* p) { return Float(*p); }
+    void store(float* p) const { *p = v; }
+
+    friend Float operator+(Float a, Float b) { return Float(a.v + b.v); }
+    friend Float operator-(Float a, Float b) { return Float(a.v - b.v); }
+    friend Float operator*(Float a, Float b) { return Float(a.v * b.v); }
+    friend Float operator/(Float a, Float b) { return Float(a.v / b.v); }
+    friend Float min(Float a, Float b) { return Float(a.v < b.v ? a.v : b.v); }
+    friend Float max(Float a, Float b) { return Float(a.v > b.v ? a.v : b.v); }
+    friend Float sqrt(Float a) { return Float(std::sqrt(a.v)); }
+    /** @brief a * b + c */
+    friend Float fma(Float a, Float b, Float c) { return Float(a.v * b.v + c.v); }
+};
+
+#endif
+
+} // namespace simd
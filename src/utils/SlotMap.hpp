@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Generational handle into a SlotMap
+ *
+ * A handle stays valid until its element is erased; after that the slot's
+ * generation moves on and the stale handle resolves to nothing instead of to
+ * whatever reuses the slot. Generation 0 is never issued, so a
+ * default-constructed handle (and the packed value 0) is always invalid.
+ *
+ * @tparam Tag Distinguishes handle types of unrelated maps
+ */
+template<typename Tag>
+struct SlotHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    bool isValid() const { return generation != 0; }
+
+    /** @brief Pack into 64 bits (generation high, index low) */
+    uint64_t toBits() const { return (static_cast<uint64_t>(generation) << 32) | index; }
+    static SlotHandle fromBits(uint64_t bits) {
+        return SlotHandle{static_cast<uint32_t>(bits), static_cast<uint32_t>(bits >> 32)};
+    }
+
+    bool operator==(const SlotHandle&) const = default;
+};
+
+/**
+ * @brief Dense container addressed by generational handles
+ *
+ * Elements live contiguously in [0, size()) for cache-friendly iteration (and
+ * index-based parallel loops). Insertion reuses freed slots; erasure
+ * swap-removes from the dense array and patches the moved element's slot, so
+ * both are O(1). Dense indices are not stable across erase(); handles are.
+ *
+ * @tparam T Stored element type (must be movable)
+ * @tparam Tag Handle tag, defaults to T
+ */
+template<typename T, typename Tag = T>
+class SlotMap {
+public:
+    using Handle = SlotHandle<Tag>;
+
+    /**
+     * @brief Construct an element in place
+     * @return Handle to the new element
+     */
+    template<typename... Args>
+    Handle emplace(Args&&... args) {
+        uint32_t slotIndex;
+        if (m_freeHead != INVALID_INDEX) {
+            slotIndex = m_freeHead;
+            m_freeHead = m_slots[slotIndex].denseIndex;
+        } else {
+            slotIndex = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back(Slot{});
+        }
+
+        Slot& slot = m_slots[slotIndex];
+        slot.denseIndex = static_cast<uint32_t>(m_dense.size());
+        m_dense.emplace_back(std::forward<Args>(args)...);
+        m_denseToSlot.push_back(slotIndex);
+
+        return Handle{slotIndex, slot.generation};
+    }
+
+    /**
+     * @brief Remove an element
+     * @param handle Element to remove
+     * @param extracted Receives the removed element (optional)
+     * @return false if the handle was stale
+     */
+    bool erase(Handle handle, T* extracted = nullptr) {
+        if (!contains(handle)) return false;
+
+        Slot& slot = m_slots[handle.index];
+        uint32_t denseIndex = slot.denseIndex;
+        uint32_t lastIndex = static_cast<uint32_t>(m_dense.size() - 1);
+
+        if (extracted) {
+            *extracted = std::move(m_dense[denseIndex]);
+        }
+        if (denseIndex != lastIndex) {
+            m_dense[denseIndex] = std::move(m_dense[lastIndex]);
+            m_denseToSlot[denseIndex] = m_denseToSlot[lastIndex];
+            m_slots[m_denseToSlot[denseIndex]].denseIndex = denseIndex;
+        }
+        m_dense.pop_back();
+        m_denseToSlot.pop_back();
+
+        // Retire the slot: bump generation (skipping 0) and push it on the free list
+        if (++slot.generation == 0) slot.generation = 1;
+        slot.denseIndex = m_freeHead;
+        m_freeHead = handle.index;
+        return true;
+    }
+
+    /**
+     * @brief Check whether a handle refers to a live element
+     */
+    bool contains(Handle handle) const {
+        return handle.isValid() && handle.index < m_slots.size() &&
+               m_slots[handle.index].generation == handle.generation;
+    }
+
+    /**
+     * @brief Resolve a handle (nullptr if stale)
+     */
+    T* get(Handle handle) { return contains(handle) ? &m_dense[m_slots[handle.index].denseIndex] : nullptr; }
+    const T* get(Handle handle) const {
+        return contains(handle) ? &m_dense[m_slots[handle.index].denseIndex] : nullptr;
+    }
+
+    /**
+     * @brief Dense index of a live element (for parallel arrays kept beside the map)
+     */
+    uint32_t denseIndexOf(Handle handle) const {
+        assert(contains(handle));
+        return m_slots[handle.index].denseIndex;
+    }
+
+    /**
+     * @brief Handle of the element at a dense index
+     */
+    Handle handleAt(size_t denseIndex) const {
+        uint32_t slotIndex = m_denseToSlot[denseIndex];
+        return Handle{slotIndex, m_slots[slotIndex].generation};
+    }
+
+    /**
+     * @brief Remove every element (outstanding handles become stale)
+     */
+    void clear() {
+        for (size_t i = m_dense.size(); i-- > 0;) {
+            erase(handleAt(i));
+        }
+    }
+
+    void reserve(size_t capacity) {
+        m_dense.reserve(capacity);
+        m_denseToSlot.reserve(capacity);
+        m_slots.reserve(capacity);
+    }
+
+    size_t size() const { return m_dense.size(); }
+    bool empty() const { return m_dense.empty(); }
+
+    // Dense access / iteration
+    T& operator[](size_t denseIndex) { return m_dense[denseIndex]; }
+    const T& operator[](size_t denseIndex) const { return m_dense[denseIndex]; }
+    T* data() { return m_dense.data(); }
+    const T* data() const { return m_dense.data(); }
+    auto begin() { return m_dense.begin(); }
+    auto end() { return m_dense.end(); }
+    auto begin() const { return m_dense.begin(); }
+    auto end() const { return m_dense.end(); }
+
+private:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    struct Slot {
+        uint32_t denseIndex = INVALID_INDEX;  // Next free slot while on the free list
+        uint32_t generation = 1;
+    };
+
+    std::vector<T> m_dense;
+    std::vector<uint32_t> m_denseToSlot;
+    std::vector<Slot> m_slots;
+    uint32_t m_freeHead = INVALID_INDEX;
+};
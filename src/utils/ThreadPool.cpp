@@ -0,0 +1,117 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+namespace {
+// Set while a thread executes a chunk so nested parallelFor() runs inline
+thread_local bool t_insideChunk = false;
+}
+
+ThreadPool::ThreadPool(uint32_t workerCount) {
+#ifdef __EMSCRIPTEN__
+    (void)workerCount;
+#else
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+#endif
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeCondition.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+uint32_t ThreadPool::defaultWorkerCount() {
+#ifdef __EMSCRIPTEN__
+    return 0;
+#else
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads <= 1) return 0;
+    // Leave the caller its own core; the render thread is the caller
+    return std::min(hardwareThreads - 1, 15u);
+#endif
+}
+
+void ThreadPool::parallelFor(uint32_t count, uint32_t chunkCount, const ChunkFn& fn) {
+    if (count == 0) return;
+    chunkCount = std::clamp(chunkCount, 1u, count);
+
+    // Serial path: single chunk, no workers, or called from inside a chunk
+    if (chunkCount == 1 || m_workers.empty() || t_insideChunk) {
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            uint32_t begin, end;
+            chunkRange(count, chunkCount, chunk, begin, end);
+            fn(chunk, begin, end);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(m_submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &fn;
+        m_jobCount = count;
+        m_jobChunks = chunkCount;
+        m_nextChunk = 0;
+        m_finishedChunks = 0;
+        ++m_generation;
+    }
+    m_wakeCondition.notify_all();
+
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_finishedChunks == m_jobChunks; });
+    m_job = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    uint64_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&] { return m_stop || m_generation != seenGeneration; });
+            if (m_stop) return;
+            seenGeneration = m_generation;
+        }
+        runChunks();
+    }
+}
+
+void ThreadPool::runChunks() {
+    for (;;) {
+        const ChunkFn* job;
+        uint32_t chunk, count, chunkCount;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_job || m_nextChunk >= m_jobChunks) return;
+            job = m_job;
+            chunk = m_nextChunk++;
+            count = m_jobCount;
+            chunkCount = m_jobChunks;
+        }
+
+        uint32_t begin, end;
+        chunkRange(count, chunkCount, chunk, begin, end);
+        t_insideChunk = true;
+        (*job)(chunk, begin, end);
+        t_insideChunk = false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (++m_finishedChunks == chunkCount) {
+            m_doneCondition.notify_all();
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size worker pool for data-parallel loops.
+ *
+ * parallelFor() splits [0, count) into contiguous chunks and blocks until all
+ * of them have run. The calling thread executes chunks alongside the workers.
+ * Chunk boundaries depend only on (count, chunkCount), so two loops over the
+ * same range see identical chunks (radix sort histogram/scatter relies on it).
+ *
+ * Under Emscripten the pool has no workers and every loop runs inline.
+ * Calls made from inside a running chunk also run inline instead of deadlocking.
+ */
+class ThreadPool {
+public:
+    using ChunkFn = std::function<void(uint32_t chunkIndex, uint32_t begin, uint32_t end)>;
+
+    explicit ThreadPool(uint32_t workerCount = defaultWorkerCount());
+    ~ThreadPool();
+
+    // Non-copyable
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Process-wide pool shared by engine subsystems
+     */
+    static ThreadPool& shared();
+
+    /**
+     * @brief Worker count used by shared(): hardware threads minus the caller
+     */
+    static uint32_t defaultWorkerCount();
+
+    /**
+     * @brief Number of threads executing chunks (workers + calling thread)
+     */
+    uint32_t getConcurrency() const { return static_cast<uint32_t>(m_workers.size()) + 1; }
+
+    /**
+     * @brief Run fn over [0, count) split into chunkCount contiguous chunks
+     * @param count Number of items
+     * @param chunkCount Number of chunks (clamped to [1, count])
+     * @param fn Called as fn(chunkIndex, begin, end) for every chunk
+     */
+    void parallelFor(uint32_t count, uint32_t chunkCount, const ChunkFn& fn);
+
+    /**
+     * @brief Bounds of a chunk as used by parallelFor()
+     */
+    static void chunkRange(uint32_t count, uint32_t chunkCount, uint32_t chunkIndex,
+                           uint32_t& begin, uint32_t& end) {
+        begin = static_cast<uint32_t>(static_cast<uint64_t>(count) * chunkIndex / chunkCount);
+        end = static_cast<uint32_t>(static_cast<uint64_t>(count) * (chunkIndex + 1) / chunkCount);
+    }
+
+private:
+    void workerLoop();
+    void runChunks();
+
+    std::vector<std::thread> m_workers;
+
+    // Serializes concurrent parallelFor() callers
+    std::mutex m_submitMutex;
+
+    // Current job (chunks are coarse, so claiming them under the lock is cheap)
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_doneCondition;
+    const ChunkFn* m_job = nullptr;
+    uint32_t m_jobCount = 0;
+    uint32_t m_jobChunks = 0;
+    uint32_t m_nextChunk = 0;
+    uint32_t m_finishedChunks = 0;
+    uint64_t m_generation = 0;
+    bool m_stop = false;
+};
@@ -0,0 +1,191 @@
+/**
+ * @file market_decode_bench.cpp
+ * @brief Tick wire decoder microbenchmark
+ *
+ * Measures:
+ * 1. Decode-only throughput (counting sink), 1..N threads each decoding its own buffer
+ * 2. Decode into MarketDataQueue (N producer threads, frame loop draining on main thread)
+ * 3. MockDataGenerator throughput (one step over every symbol into a reused batch)
+ *
+ * Usage: market_decode_bench [symbols] [ticks]
+ */
+
+#include "src/game/sync/TickCodec.hpp"
+#include "src/game/sync/MarketDataQueue.hpp"
+#include "src/game/sync/MockDataGenerator.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t TICKS_PER_FRAME = 1024;   // Ticks per wire frame (one receive buffer's worth)
+
+std::vector<std::byte> buildStream(uint32_t symbolCount, size_t tickCount) {
+    std::vector<SymbolId> symbols;
+    symbols.reserve(symbolCount);
+    for (uint32_t i = 0; i < symbolCount; ++i) {
+        symbols.push_back(SymbolTable::global().intern("BENCH_" + std::to_string(i)));
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> pickSymbol(0, symbolCount - 1);
+    std::uniform_real_distribution<float> pickPrice(10.0f, 500.0f);
+
+    std::vector<std::byte> stream;
+    stream.reserve(tickwire::tickFrameSize(tickCount) + tickCount / TICKS_PER_FRAME * sizeof(tickwire::TickFrameHeader));
+    TickEncoder::appendSymbolDirectory(symbols, stream);
+
+    PriceUpdateBatch frame;
+    frame.reserve(TICKS_PER_FRAME);
+    for (size_t i = 0; i < tickCount; ++i) {
+        PriceUpdate update(symbols[pickSymbol(rng)], pickPrice(rng), 1700000000000ull + i);
+        update.volume = 100.0f;
+        frame.push_back(update);
+        if (frame.size() == TICKS_PER_FRAME || i + 1 == tickCount) {
+            TickEncoder::appendTicks(frame, stream);
+            frame.clear();
+        }
+    }
+    return stream;
+}
+
+void printResult(const char* label, unsigned threads, uint64_t ticks, double seconds) {
+    double perSecond = ticks / seconds;
+    std::cout << "  " << std::left << std::setw(24) << label
+              << std::right << std::setw(3) << threads << " thread(s): "
+              << std::fixed << std::setprecision(1)
+              << std::setw(8) << perSecond / 1e6 << " M ticks/s total, "
+              << std::setw(8) << perSecond / threads / 1e6 << " M ticks/s/core\n";
+}
+
+void benchDecodeOnly(const std::vector<std::byte>& stream, unsigned threads, int passes) {
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> checksum{0};
+
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            TickDecoder decoder;
+            uint64_t ticks = 0;
+            uint64_t sum = 0;
+            for (int pass = 0; pass < passes; ++pass) {
+                auto result = decoder.decode(stream, [&sum](const PriceUpdate& update) {
+                    sum += update.symbol + update.timestamp;
+                    return true;
+                });
+                ticks += result.ticks;
+            }
+            total += ticks;
+            checksum += sum;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    printResult("decode only", threads, total.load(), seconds);
+    if (checksum.load() == 0) {
+        std::cout << "  (empty checksum)\n";
+    }
+}
+
+void benchDecodeToQueue(const std::vector<std::byte>& stream, unsigned producers, int passes) {
+    MarketDataQueue queue(1u << 18);
+    std::atomic<unsigned> running{producers};
+    std::atomic<uint64_t> total{0};
+
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < producers; ++t) {
+        workers.emplace_back([&] {
+            TickDecoder decoder;
+            uint64_t ticks = 0;
+            for (int pass = 0; pass < passes; ++pass) {
+                ticks += decoder.decode(stream, queue).ticks;
+            }
+            total += ticks;
+            running--;
+        });
+    }
+
+    // Stand-in for the frame loop: drain until producers finish and the ring is empty
+    PriceUpdateBatch batch;
+    while (running.load() > 0 || queue.getDepth() > 0) {
+        queue.drain(batch);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    auto stats = queue.getStats();
+    printResult("decode -> queue", producers, total.load(), seconds);
+    std::cout << "      dropped (past symbol capacity): " << stats.dropped
+              << ", coalesced: " << stats.coalesced << "\n";
+}
+
+void benchGenerator(uint32_t symbolCount, int steps) {
+    MockDataGenerator generator;
+    for (uint32_t i = 0; i < symbolCount; ++i) {
+        generator.registerTicker("BENCH_" + std::to_string(i), 100.0f, i % 16);
+    }
+
+    PriceUpdateBatch batch;
+    generator.generateUpdates(batch);  // Warm-up; sizes the batch
+
+    auto start = Clock::now();
+    for (int step = 0; step < steps; ++step) {
+        generator.generateUpdates(batch);
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout << "  mock generator           " << std::fixed << std::setprecision(1)
+              << static_cast<double>(symbolCount) * steps / seconds / 1e6 << " M ticks/s ("
+              << symbolCount << " symbols, all threads)\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    uint32_t symbolCount = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 10000;
+    size_t tickCount = argc > 2 ? static_cast<size_t>(std::strtoull(argv[2], nullptr, 10)) : 4000000;
+    if (symbolCount == 0 || tickCount == 0) {
+        std::cerr << "Usage: market_decode_bench [symbols] [ticks]\n";
+        return 1;
+    }
+
+    std::cout << "=== Tick Decoder Benchmark ===\n";
+    auto stream = buildStream(symbolCount, tickCount);
+    std::cout << "  " << symbolCount << " symbols, " << tickCount << " ticks, "
+              << stream.size() / (1024 * 1024) << " MiB encoded ("
+              << sizeof(tickwire::TickRecord) << " bytes/tick)\n\n";
+
+    const int passes = 5;
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        benchDecodeOnly(stream, threads, passes);
+    }
+    std::cout << "\n";
+
+    // Leave one core for the draining consumer
+    unsigned maxProducers = std::max(1u, maxThreads - 1);
+    for (unsigned producers = 1; producers <= maxProducers; producers *= 2) {
+        benchDecodeToQueue(stream, producers, passes);
+    }
+    std::cout << "\n";
+
+    benchGenerator(std::max<uint32_t>(symbolCount, 100000), 50);
+    return 0;
+}
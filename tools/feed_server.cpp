@@ -0,0 +1,329 @@
+/**
+ * @file feed_server.cpp
+ * @brief Local market-data feed server (stand-in for an exchange gateway)
+ *
+ * Serves tick wire frames (src/game/sync/TickCodec.hpp) over a TCP or Unix
+ * socket to one client at a time, so the engine's FeedIngestor can be
+ * exercised end to end on one machine. Each session starts with a symbol
+ * directory, then streams either:
+ *   - a recorded tick file, paced by its index (--file, --speed, --loop), or
+ *   - MockDataGenerator output at a target tick rate (--symbols, --rate).
+ * Sends block, so a client that applies backpressure slows the server.
+ *
+ * Usage:
+ *   feed_server [--listen tcp://127.0.0.1:9000 | unix:///tmp/feed.sock]
+ *               [--file market.ticks [--speed 1] [--loop]]
+ *               [--symbols 10000] [--prefix B_] [--rate 1000000] [--seed 1]
+ */
+
+#include "src/game/sync/FeedIngestor.hpp"
+#include "src/game/sync/MockDataGenerator.hpp"
+#include "src/game/sync/TickFile.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t TICKS_PER_FRAME = 4096;
+
+std::atomic<bool> g_running{true};
+
+struct Options {
+    FeedEndpoint endpoint;
+    std::string file;
+    float speed = 1.0f;
+    bool loop = false;
+    uint32_t symbols = 10000;
+    std::string prefix = "B_";
+    double rate = 1e6;
+    uint64_t seed = MockDataGenerator::DEFAULT_SEED;
+};
+
+uint64_t nowMs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+bool sendAll(int socket, const std::byte* data, size_t size) {
+    while (size > 0) {
+        ssize_t sent = ::send(socket, data, size, 0);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+int listenSocket(const FeedEndpoint& endpoint) {
+    if (endpoint.kind == FeedEndpoint::Kind::Unix) {
+        int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket < 0) {
+            return -1;
+        }
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, endpoint.path.c_str(), sizeof(address.sun_path) - 1);
+        ::unlink(endpoint.path.c_str());
+        if (::bind(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+            || ::listen(socket, 1) != 0) {
+            ::close(socket);
+            return -1;
+        }
+        return socket;
+    }
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo* addresses = nullptr;
+    std::string port = std::to_string(endpoint.port);
+    if (::getaddrinfo(endpoint.host.c_str(), port.c_str(), &hints, &addresses) != 0) {
+        return -1;
+    }
+
+    int socket = -1;
+    for (addrinfo* address = addresses; address && socket < 0; address = address->ai_next) {
+        socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (socket < 0) {
+            continue;
+        }
+        int reuse = 1;
+        ::setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (::bind(socket, address->ai_addr, address->ai_addrlen) != 0 || ::listen(socket, 1) != 0) {
+            ::close(socket);
+            socket = -1;
+        }
+    }
+    ::freeaddrinfo(addresses);
+    return socket;
+}
+
+/**
+ * @brief Prints throughput once per second
+ */
+class RateMeter {
+public:
+    void add(uint64_t ticks, uint64_t bytes) {
+        m_ticks += ticks;
+        m_bytes += bytes;
+        auto now = Clock::now();
+        double elapsed = std::chrono::duration<double>(now - m_last).count();
+        if (elapsed >= 1.0) {
+            std::cout << "  " << static_cast<uint64_t>(m_ticks / elapsed) << " ticks/s, "
+                      << m_bytes / elapsed / (1024.0 * 1024.0) << " MiB/s\n";
+            m_ticks = 0;
+            m_bytes = 0;
+            m_last = now;
+        }
+    }
+
+private:
+    Clock::time_point m_last = Clock::now();
+    uint64_t m_ticks = 0;
+    uint64_t m_bytes = 0;
+};
+
+/**
+ * @brief Stream a recorded tick file, pacing frames by their recorded times
+ */
+bool serveFile(int client, const TickFileReader& reader, const Options& options) {
+    RateMeter meter;
+
+    // Directories first so every tick of the session resolves
+    for (size_t frame = 0; frame < reader.getFrameCount(); ++frame) {
+        if (reader.getFrameType(frame) == tickwire::FrameType::SymbolDirectory) {
+            auto data = reader.getFrameData(frame);
+            if (!sendAll(client, data.data(), data.size())) {
+                return false;
+            }
+        }
+    }
+
+    do {
+        auto start = Clock::now();
+        uint64_t firstTimestamp = reader.getFirstTimestamp();
+
+        for (size_t frame = 0; frame < reader.getFrameCount() && g_running; ++frame) {
+            if (reader.getFrameType(frame) != tickwire::FrameType::TickBatch) {
+                continue;
+            }
+            const auto& entry = reader.getFrame(frame);
+            if (options.speed > 0.0f) {
+                double offsetSeconds = static_cast<double>(entry.timestamp - firstTimestamp) / 1000.0 / options.speed;
+                std::this_thread::sleep_until(start + std::chrono::duration_cast<Clock::duration>(
+                    std::chrono::duration<double>(offsetSeconds)));
+            }
+
+            // Frames go to the socket straight out of the mapping
+            auto data = reader.getFrameData(frame);
+            if (!sendAll(client, data.data(), data.size())) {
+                return false;
+            }
+            meter.add((data.size() - sizeof(tickwire::TickFrameHeader)) / sizeof(tickwire::TickRecord), data.size());
+        }
+    } while (options.loop && g_running);
+    return true;
+}
+
+/**
+ * @brief Stream generated ticks at the requested rate
+ */
+bool serveGenerated(int client, MockDataGenerator& generator, const std::vector<SymbolId>& symbols,
+                    const Options& options) {
+    std::vector<std::byte> buffer;
+    TickEncoder::appendSymbolDirectory(symbols, buffer);
+    if (!sendAll(client, buffer.data(), buffer.size())) {
+        return false;
+    }
+
+    RateMeter meter;
+    PriceUpdateBatch batch;
+    const auto stepInterval = std::chrono::duration<double>(static_cast<double>(symbols.size()) / options.rate);
+    auto nextStep = Clock::now();
+
+    while (g_running) {
+        generator.generateUpdates(batch);
+        uint64_t timestamp = nowMs();
+        for (auto& update : batch) {
+            update.timestamp = timestamp;
+            update.volume = 100.0f;
+        }
+
+        buffer.resize(tickwire::tickFrameSize(TICKS_PER_FRAME));
+        for (size_t offset = 0; offset < batch.size(); offset += TICKS_PER_FRAME) {
+            size_t count = std::min<size_t>(TICKS_PER_FRAME, batch.size() - offset);
+            size_t bytes = TickEncoder::encodeTicks(std::span<const PriceUpdate>(batch.data() + offset, count), buffer);
+            if (!sendAll(client, buffer.data(), bytes)) {
+                return false;
+            }
+            meter.add(count, bytes);
+        }
+
+        nextStep += std::chrono::duration_cast<Clock::duration>(stepInterval);
+        std::this_thread::sleep_until(nextStep);
+    }
+    return true;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    FeedEndpoint::parse("tcp://127.0.0.1:9000", options.endpoint);
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : std::string(); };
+
+        if (arg == "--listen") {
+            if (!FeedEndpoint::parse(next(), options.endpoint)) {
+                std::cerr << "Invalid endpoint\n";
+                return false;
+            }
+        } else if (arg == "--file") {
+            options.file = next();
+        } else if (arg == "--speed") {
+            options.speed = std::stof(next());
+        } else if (arg == "--loop") {
+            options.loop = true;
+        } else if (arg == "--symbols") {
+            options.symbols = static_cast<uint32_t>(std::stoul(next()));
+        } else if (arg == "--prefix") {
+            options.prefix = next();
+        } else if (arg == "--rate") {
+            options.rate = std::stod(next());
+        } else if (arg == "--seed") {
+            options.seed = std::stoull(next());
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+    }
+    return options.symbols > 0 && options.rate > 0.0;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    try {
+        if (!parseOptions(argc, argv, options)) {
+            std::cerr << "Usage: feed_server [--listen ENDPOINT] [--file PATH [--speed N] [--loop]]"
+                         " [--symbols N] [--prefix P] [--rate TICKS_PER_SEC] [--seed S]\n";
+            return 1;
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Invalid option value\n";
+        return 1;
+    }
+
+    std::signal(SIGPIPE, SIG_IGN);
+    std::signal(SIGINT, [](int) { g_running = false; });
+
+    TickFileReader reader;
+    MockDataGenerator generator(options.seed);
+    std::vector<SymbolId> symbols;
+
+    if (!options.file.empty()) {
+        if (!reader.open(options.file)) {
+            return 1;
+        }
+    } else {
+        for (uint32_t i = 0; i < options.symbols; ++i) {
+            SymbolId symbol = SymbolTable::global().intern(options.prefix + std::to_string(i));
+            symbols.push_back(symbol);
+            generator.registerSymbol(symbol, 100.0f + static_cast<float>(i % 200), i % 16);
+        }
+    }
+
+    int listener = listenSocket(options.endpoint);
+    if (listener < 0) {
+        std::cerr << "Failed to listen on " << options.endpoint.toString() << ": " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    std::cout << "Serving " << (options.file.empty() ? "generated ticks" : options.file)
+              << " on " << options.endpoint.toString() << "\n";
+
+    while (g_running) {
+        int client = ::accept(listener, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        std::cout << "Client connected\n";
+
+        bool completed = options.file.empty()
+            ? serveGenerated(client, generator, symbols, options)
+            : serveFile(client, reader, options);
+
+        ::close(client);
+        std::cout << (completed ? "Stream finished\n" : "Client disconnected\n");
+    }
+
+    ::close(listener);
+    if (options.endpoint.kind == FeedEndpoint::Kind::Unix) {
+        ::unlink(options.endpoint.path.c_str());
+    }
+    return 0;
+}